@@ -157,7 +157,7 @@ static inline float MyCalcTextWidthA(ImFont* font,float size, const char* text_b
             if (codepoint == tab) ++numTabs;
         }
     }
-    text_width = scale * (font->FallbackAdvanceX * (numUTF8Chars-numTabs) + font->IndexAdvanceX[tab] * numTabs);
+    text_width = scale * (font->FallbackAdvanceX * (numUTF8Chars-numTabs) + font->GetCharAdvance(tab) * numTabs);
     if (remaining)  *remaining = (const char*) s;
 #       endif //IMGUICODEEDITOR_USE_UTF8HELPER_H
 #   endif //NO_IMGUICODEEDITOR_USE_OPT_FOR_MONOSPACE_FONTS
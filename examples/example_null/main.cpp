@@ -1,35 +1,1094 @@
 // dear imgui: null/dummy example application (compile and link imgui with no inputs, no outputs)
+// This is also used as a headless benchmark harness: it runs a set of representative workloads and reports their cost in CSV format.
+// Usage: example_null [--frames N] [--warmup N] [--filter substring] [--glyph-run-cache] [--fonts-dir path]
+// Output columns:
+//  workload, frames, ns_per_frame (average), ns_per_frame_min, ns_per_frame_max, vertices_per_frame, indices_per_frame, draw_cmds_per_frame, allocs_per_frame, alloc_bytes_per_frame
+// Time, allocations and geometry are measured from NewFrame() to Render() included. Allocations are counted via SetAllocatorFunctions().
+// The drawlist_polyline workload measures ImDrawList::AddPolyline() alone (one "frame" per set of polylines).
+// The drawlist_jobs_serial/drawlist_jobs_threads workloads run the same AddDrawListJob() frames serially and on 8 threads, checking that outputs and allocation counters match.
+// The render_no_content_hash/render_content_hash/draw_data_upload workloads time Render() alone without and with ImGuiBackendFlags_RendererHasContentHash, and a copy of the draw data buffers.
+// The storage_* workloads measure ImGuiStorage insertions and queries (one "frame" per N keys), with and without io.ConfigStorageUseHashMap, at 1K/10K/100K keys.
+// The hovered_window_* workloads time NewFrame() with 100/1K/10K windows, finding the hovered window with the hit grid or the linear scan, and Render() when all windows move.
+// The hash_* workloads measure ImHashStr()/ImHashData() with the implementation selected in imconfig.h (one "frame" per set of labels or per 1 MB buffer), and count ID collisions.
+// The font_atlas_build/font_atlas_load_cache workloads measure ImFontAtlas::Build()/LoadCacheFromMemory() instead (one "frame" per build, no geometry), loading the misc/fonts/ files at several sizes.
 #include "imgui.h"
+#include "imgui_internal.h"     // ImHashStr(), ImHashData()
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#endif
 
-int main(int, char**)
+//-----------------------------------------------------------------------------
+// Platform helpers: timer, atomic counters, threads
+//-----------------------------------------------------------------------------
+
+#ifdef _WIN32
+typedef volatile LONG64 AtomicCounter;
+static long long AtomicAdd(AtomicCounter* counter, long long value)    { return InterlockedExchangeAdd64(counter, value); }
+static int      GetHardwareThreadsCount()                               { SYSTEM_INFO info; GetSystemInfo(&info); return (int)info.dwNumberOfProcessors; }
+static double   GetTimeNs()
 {
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
+    static LARGE_INTEGER frequency = {};
+    if (frequency.QuadPart == 0)
+        QueryPerformanceFrequency(&frequency);
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return (double)counter.QuadPart * 1e9 / (double)frequency.QuadPart;
+}
+#else
+typedef volatile long long AtomicCounter;
+static long long AtomicAdd(AtomicCounter* counter, long long value)    { return __sync_fetch_and_add(counter, value); }
+static int      GetHardwareThreadsCount()                               { return (int)sysconf(_SC_NPROCESSORS_ONLN); }
+static double   GetTimeNs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+#endif
+
+// Minimal job system: workers (the calling thread being one of them) pulling job indices from a shared counter.
+struct ParallelForData
+{
+    void            (*JobFunc)(void* job_data, int job_index);
+    void*           JobData;
+    int             JobCount;
+    AtomicCounter   NextJob;
+};
+
+static void ParallelForWorker(ParallelForData* data)
+{
+    for (int job_index = (int)AtomicAdd(&data->NextJob, 1); job_index < data->JobCount; job_index = (int)AtomicAdd(&data->NextJob, 1))
+        data->JobFunc(data->JobData, job_index);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI ParallelForThreadFunc(LPVOID data)  { ParallelForWorker((ParallelForData*)data); return 0; }
+#else
+static void*    ParallelForThreadFunc(void* data)       { ParallelForWorker((ParallelForData*)data); return NULL; }
+#endif
+
+static void ParallelForThreads(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, int workers_count)
+{
+    ParallelForData data;
+    data.JobFunc = job_func;
+    data.JobData = job_data;
+    data.JobCount = job_count;
+    data.NextJob = 0;
+    const int threads_count = (workers_count < job_count ? workers_count : job_count) - 1;
+#ifdef _WIN32
+    ImVector<HANDLE> threads;
+    for (int n = 0; n < threads_count; n++)
+        threads.push_back(CreateThread(NULL, 0, ParallelForThreadFunc, &data, 0, NULL));
+    ParallelForWorker(&data);
+    for (int n = 0; n < threads.Size; n++)
+    {
+        WaitForSingleObject(threads[n], INFINITE);
+        CloseHandle(threads[n]);
+    }
+#else
+    ImVector<pthread_t> threads;
+    for (int n = 0; n < threads_count; n++)
+    {
+        pthread_t thread;
+        if (pthread_create(&thread, NULL, ParallelForThreadFunc, &data) == 0)
+            threads.push_back(thread);
+    }
+    ParallelForWorker(&data);
+    for (int n = 0; n < threads.Size; n++)
+        pthread_join(threads[n], NULL);
+#endif
+}
+
+// One worker per hardware thread. Matches the signature of ImFontAtlas::BuildParallelForFunc.
+static void ParallelFor(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void*)
+{
+    ParallelForThreads(job_func, job_data, job_count, GetHardwareThreadsCount());
+}
+
+// Counting allocator (atomic counters as ImFontAtlas::BuildParallelForFunc and draw list jobs allocate from worker threads)
+static AtomicCounter    g_AllocCount = 0;
+static AtomicCounter    g_AllocBytes = 0;
+static AtomicCounter    g_FreeCount = 0;
+static void*    CountingAlloc(size_t size, void*)   { AtomicAdd(&g_AllocCount, 1); AtomicAdd(&g_AllocBytes, (long long)size); return malloc(size); }
+static void     CountingFree(void* ptr, void*)      { if (ptr) AtomicAdd(&g_FreeCount, 1); free(ptr); }
+
+//-----------------------------------------------------------------------------
+// Workloads
+// Each workload is called once per frame between NewFrame() and Render(), then its optional Shutdown function is called after the last frame.
+//-----------------------------------------------------------------------------
+
+static void WorkloadHelloWorld(int)
+{
+    static float f = 0.0f;
+    ImGui::Text("Hello, world!");
+    ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
+    ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / ImGui::GetIO().Framerate, ImGui::GetIO().Framerate);
+}
+
+static void WorkloadDemoWindow(int)
+{
+    ImGui::ShowDemoWindow(NULL);
+    ImGui::ShowMetricsWindow(NULL);
+    ImGui::Begin("Style Editor");
+    ImGui::ShowStyleEditor();
+    ImGui::End();
+}
+
+static void WorkloadListClipper(int)
+{
+    const int ITEMS_COUNT = 10000;
+    static int selected = 0;
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(400, 800));
+    ImGui::Begin("List");
+    ImGuiListClipper clipper(ITEMS_COUNT);
+    while (clipper.Step())
+        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+        {
+            char label[32];
+            sprintf(label, "Item %05d", i);
+            if (ImGui::Selectable(label, selected == i))
+                selected = i;
+        }
+    ImGui::End();
+}
+
+static void WorkloadColumns(int)
+{
+    const int COLUMNS_COUNT = 8;
+    const int ROWS_COUNT = 500;
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(1200, 1000));
+    ImGui::Begin("Columns");
+    ImGui::Columns(COLUMNS_COUNT, "table");
+    ImGui::Separator();
+    for (int row = 0; row < ROWS_COUNT; row++)
+        for (int column = 0; column < COLUMNS_COUNT; column++)
+        {
+            if (column == 0)
+                ImGui::Text("Row %d", row);
+            else
+                ImGui::Text("%.3f", row * 0.25f + column);
+            ImGui::NextColumn();
+        }
+    ImGui::Columns(1);
+    ImGui::End();
+}
+
+static char*    g_InputTextBuf = NULL;
+static size_t   g_InputTextBufSize = 0;
+
+static void WorkloadInputTextMultiline(int frame)
+{
+    const int LINES_COUNT = 20000;
+    if (g_InputTextBuf == NULL)
+    {
+        g_InputTextBufSize = LINES_COUNT * 64 + 1;
+        g_InputTextBuf = (char*)malloc(g_InputTextBufSize);
+        char* p = g_InputTextBuf;
+        for (int n = 0; n < LINES_COUNT; n++)
+            p += sprintf(p, "%05d: The quick brown fox jumps over the lazy dog.\n", n);
+    }
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(800, 1000));
+    ImGui::Begin("Text Editor");
+    if (frame == 0)
+        ImGui::SetKeyboardFocusHere();
+    ImGui::InputTextMultiline("##source", g_InputTextBuf, g_InputTextBufSize, ImVec2(-1.0f, -1.0f));
+    ImGui::End();
+}
+
+static void WorkloadInputTextMultilineShutdown()
+{
+    free(g_InputTextBuf);
+    g_InputTextBuf = NULL;
+    g_InputTextBufSize = 0;
+}
+
+static void WorkloadDrawListPlot(int frame)
+{
+    const int POINTS_COUNT = 10000;
+    static float values[POINTS_COUNT];
+    static ImVec2 points[POINTS_COUNT];
+    for (int n = 0; n < POINTS_COUNT; n++)
+        values[n] = sinf((n + frame) * 0.01f) + 0.3f * sinf((n + frame) * 0.17f);
+
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(1400, 1000));
+    ImGui::Begin("Plot");
+    ImGui::PlotLines("Lines", values, POINTS_COUNT, 0, NULL, -1.5f, 1.5f, ImVec2(0, 200));
+    ImGui::PlotHistogram("Histogram", values, 1000, 0, NULL, -1.5f, 1.5f, ImVec2(0, 100));
+
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    const ImVec2 p = ImGui::GetCursorScreenPos();
+    const ImVec2 size(1300.0f, 500.0f);
+    for (int n = 0; n < POINTS_COUNT; n++)
+        points[n] = ImVec2(p.x + size.x * n / (POINTS_COUNT - 1), p.y + size.y * (0.5f - 0.3f * values[n]));
+    draw_list->AddPolyline(points, POINTS_COUNT, IM_COL32(255, 255, 0, 255), false, 2.0f);
+    for (int n = 0; n < 500; n++)
+    {
+        const ImVec2 c(p.x + (n % 50) * 26.0f + 13.0f, p.y + (n / 50) * 50.0f + 25.0f);
+        draw_list->AddCircleFilled(c, 10.0f, IM_COL32(n % 256, 128, 255 - n % 256, 255), 16);
+        draw_list->AddRect(ImVec2(c.x - 12, c.y - 12), ImVec2(c.x + 12, c.y + 12), IM_COL32(255, 255, 255, 128), 4.0f);
+        draw_list->AddBezierCurve(ImVec2(c.x - 12, c.y), ImVec2(c.x - 4, c.y - 20), ImVec2(c.x + 4, c.y + 20), ImVec2(c.x + 12, c.y), IM_COL32(255, 0, 0, 255), 1.0f);
+    }
+    ImGui::Dummy(size);
+    ImGui::End();
+}
+
+static void WorkloadTextHeavy(int frame)
+{
+    static bool checked[3][15] = {};
+    for (int window_n = 0; window_n < 3; window_n++)
+    {
+        char window_name[32];
+        sprintf(window_name, "Text %d", window_n);
+        ImGui::SetNextWindowPos(ImVec2(10.0f + window_n * 620.0f, 10.0f));
+        ImGui::SetNextWindowSize(ImVec2(600, 1050));
+        ImGui::Begin(window_name);
+        for (int n = 0; n < 30; n++)
+            ImGui::Text("Static label number %d, in window %d", n, window_n);
+        for (int n = 0; n < 10; n++)
+            ImGui::Text("Dynamic value: %d", frame * 10 + n);
+        for (int n = 0; n < 4; n++)
+            ImGui::TextWrapped("This is a longer paragraph of static text which gets word-wrapped to the width of the window. Paragraph %d.", n);
+        for (int n = 0; n < 15; n++)
+        {
+            ImGui::PushID(n);
+            ImGui::Button("Button"); ImGui::SameLine();
+            ImGui::Button("Another button"); ImGui::SameLine();
+            ImGui::Checkbox("Checkbox", &checked[window_n][n]);
+            ImGui::PopID();
+        }
+        ImGui::End();
+    }
+}
+
+struct Workload
+{
+    const char* Name;
+    void        (*Func)(int frame);
+    void        (*Shutdown)();              // Optional
+};
+
+static const Workload g_Workloads[] =
+{
+    { "hello_world",            WorkloadHelloWorld,             NULL },
+    { "demo_window",            WorkloadDemoWindow,             NULL },
+    { "list_clipper_10k",       WorkloadListClipper,            NULL },
+    { "columns_8x500",          WorkloadColumns,                NULL },
+    { "input_text_multiline",   WorkloadInputTextMultiline,     WorkloadInputTextMultilineShutdown },
+    { "drawlist_plot",          WorkloadDrawListPlot,           NULL },
+    { "text_heavy",             WorkloadTextHeavy,              NULL },
+};
+
+//-----------------------------------------------------------------------------
+// Font atlas build workloads
+//-----------------------------------------------------------------------------
+
+static bool AddBenchmarkFonts(ImFontAtlas* atlas, const char* fonts_dir)
+{
+    static const char* font_files[] = { "Roboto-Medium.ttf", "Cousine-Regular.ttf", "DroidSans.ttf", "Karla-Regular.ttf", "ProggyClean.ttf", "ProggyTiny.ttf" };
+    static const float font_sizes[] = { 13.0f, 16.0f, 20.0f, 28.0f };
+    atlas->AddFontDefault();
+    for (int file_n = 0; file_n < (int)(sizeof(font_files) / sizeof(font_files[0])); file_n++)
+    {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/%s", fonts_dir, font_files[file_n]);
+        if (FILE* f = fopen(path, "rb"))
+            fclose(f);
+        else
+            return false;
+        for (int size_n = 0; size_n < (int)(sizeof(font_sizes) / sizeof(font_sizes[0])); size_n++)
+        {
+            ImFontConfig cfg;
+            cfg.OversampleH = 3;
+            atlas->AddFontFromFileTTF(path, font_sizes[size_n], &cfg, atlas->GetGlyphRangesCyrillic());
+        }
+    }
+    return true;
+}
+
+enum FontAtlasBuildMode { FontAtlasBuildMode_Serial, FontAtlasBuildMode_Parallel, FontAtlasBuildMode_Cache };
+
+static void RunFontAtlasBuildWorkload(const char* name, const char* fonts_dir, FontAtlasBuildMode mode, int frames)
+{
+    // Prepare cache data with a first build
+    ImVector<unsigned char> cache_data;
+    if (mode == FontAtlasBuildMode_Cache)
+    {
+        ImFontAtlas atlas;
+        if (AddBenchmarkFonts(&atlas, fonts_dir))
+            atlas.Build(), atlas.SaveCacheToMemory(&cache_data);
+    }
+
+    double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+    size_t alloc_count_total = 0, alloc_bytes_total = 0;
+    unsigned int tex_hash = 0;
+    for (int n = 0; n < frames; n++)
+    {
+        ImFontAtlas atlas;
+        atlas.BuildParallelForFunc = (mode == FontAtlasBuildMode_Parallel) ? ParallelFor : NULL;
+        if (!AddBenchmarkFonts(&atlas, fonts_dir))
+        {
+            fprintf(stderr, "%s: font files not found in '%s', use --fonts-dir\n", name, fonts_dir);
+            return;
+        }
+        const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+        const double t0 = GetTimeNs();
+        if (mode != FontAtlasBuildMode_Cache || !atlas.LoadCacheFromMemory(cache_data.Data, (size_t)cache_data.Size))
+            atlas.Build();
+        const double t = GetTimeNs() - t0;
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
+        alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+        alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+
+        // FNV-1a of the texture, so results of the different modes can be compared
+        tex_hash = 2166136261u;
+        for (int i = 0; i < atlas.TexWidth * atlas.TexHeight; i++)
+            tex_hash = (tex_hash ^ atlas.TexPixelsAlpha8[i]) * 16777619u;
+    }
+
+    printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", name, frames,
+        time_total / frames, time_min, time_max, 0.0, 0.0, 0.0,
+        (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+    fprintf(stderr, "%s: texture hash %08X\n", name, tex_hash);
+    fflush(stdout);
+}
+
+//-----------------------------------------------------------------------------
+// Polyline workload: ImDrawList::AddPolyline()
+//-----------------------------------------------------------------------------
+
+// Stroke the same points thin/thick and open/closed
+static void DrawBenchmarkPolylines(ImDrawList* draw_list, const ImVec2* points, int points_count)
+{
+    draw_list->Clear();
+    draw_list->PushClipRectFullScreen();
+    draw_list->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    draw_list->AddPolyline(points, points_count, IM_COL32(255, 255, 0, 255), false, 1.0f);
+    draw_list->AddPolyline(points, points_count, IM_COL32(255, 255, 0, 255), false, 3.0f);
+    draw_list->AddPolyline(points, points_count, IM_COL32(0, 255, 255, 255), true, 1.0f);
+    draw_list->AddPolyline(points, points_count, IM_COL32(0, 255, 255, 255), true, 3.0f);
+    draw_list->PopTextureID();
+    draw_list->PopClipRect();
+}
+
+// Strokes 10K points thin/thick and open/closed, anti-aliased.
+static void RunPolylineWorkload(ImFontAtlas* atlas, int warmup_frames, int frames)
+{
+    ImGui::CreateContext(atlas);
     ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::NewFrame(); // Setup ImGui::GetDrawListSharedData()
 
-    // Build atlas
-    unsigned char* tex_pixels = NULL;
-    int tex_w, tex_h;
-    io.Fonts->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+    const int POINTS_COUNT = 10000;
+    ImVector<ImVec2> points;
+    points.resize(POINTS_COUNT);
+    for (int n = 0; n < POINTS_COUNT; n++)
+        points[n] = ImVec2(10.0f + 1900.0f * n / (POINTS_COUNT - 1), 540.0f + 300.0f * sinf(n * 0.01f) + 90.0f * sinf(n * 0.17f));
+
+    ImDrawList draw_list(ImGui::GetDrawListSharedData());
+    draw_list.Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AllowVtxOffset;
+
+    double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+    size_t alloc_count_total = 0, alloc_bytes_total = 0;
+    for (int n = 0; n < warmup_frames + frames; n++)
+    {
+        const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+        const double t0 = GetTimeNs();
+        DrawBenchmarkPolylines(&draw_list, points.Data, points.Size);
+        const double t = GetTimeNs() - t0;
+        if (n < warmup_frames)
+            continue;
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
+        alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+        alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+    }
+
+    int cmd_count = 0;
+    for (int cmd_n = 0; cmd_n < draw_list.CmdBuffer.Size; cmd_n++)
+        if (draw_list.CmdBuffer[cmd_n].ElemCount > 0)
+            cmd_count++;
+    printf("drawlist_polyline,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", frames,
+        time_total / frames, time_min, time_max,
+        (double)draw_list.VtxBuffer.Size, (double)draw_list.IdxBuffer.Size, (double)cmd_count,
+        (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+    fflush(stdout);
+
+    ImGui::EndFrame();
+    ImGui::DestroyContext();
+}
+
+//-----------------------------------------------------------------------------
+// Draw list jobs stress test: AddDrawListJob() run serially vs on worker threads
+//-----------------------------------------------------------------------------
+
+static const int DRAWLIST_JOBS_WINDOWS_COUNT = 6;
+static const int DRAWLIST_JOBS_PER_WINDOW = 16;
+static const int DRAWLIST_JOBS_THREADS_COUNT = 8;   // Regardless of the number of hardware threads, so jobs do run concurrently
 
-    for (int n = 0; n < 50; n++)
+struct DrawListJobData
+{
+    int     Frame;
+    int     Index;
+    ImVec2  Pos;
+};
+static DrawListJobData g_DrawListJobsData[DRAWLIST_JOBS_WINDOWS_COUNT * DRAWLIST_JOBS_PER_WINDOW];
+
+// Varying amounts of geometry and text per job and per frame, so draw lists grow (and allocate) from worker threads
+static void DrawListJobCallback(ImDrawList* draw_list, void* user_data)
+{
+    const DrawListJobData* data = (const DrawListJobData*)user_data;
+    const int shapes_count = 20 + (data->Frame * 7 + data->Index * 13) % 200;
+    for (int n = 0; n < shapes_count; n++)
+    {
+        const ImVec2 c(data->Pos.x + (n % 20) * 12.0f, data->Pos.y + (n / 20) * 12.0f);
+        draw_list->AddCircleFilled(c, 5.0f, IM_COL32(n * 10 % 256, data->Index * 3 % 256, 128, 255), 12);
+        draw_list->AddRect(ImVec2(c.x - 6, c.y - 6), ImVec2(c.x + 6, c.y + 6), IM_COL32(255, 255, 255, 128), 2.0f);
+    }
+    char text[64];
+    sprintf(text, "Job %d, frame %d, %d shapes", data->Index, data->Frame, shapes_count);
+    draw_list->AddText(ImVec2(data->Pos.x, data->Pos.y - 14.0f), IM_COL32_WHITE, text);
+}
+
+static void DrawListJobsDispatchThreads(ImDrawListJob** jobs, int jobs_count, void*)
+{
+    struct Funcs { static void RunJob(void* job_data, int job_index) { ImGui::RunDrawListJob(((ImDrawListJob**)job_data)[job_index]); } };
+    ParallelForThreads(Funcs::RunJob, jobs, jobs_count, DRAWLIST_JOBS_THREADS_COUNT);
+}
+
+static void SubmitDrawListJobs(int frame)
+{
+    for (int window_n = 0; window_n < DRAWLIST_JOBS_WINDOWS_COUNT; window_n++)
+    {
+        char window_name[32];
+        sprintf(window_name, "Jobs %d", window_n);
+        ImGui::SetNextWindowPos(ImVec2(10.0f + (window_n % 3) * 620.0f, 10.0f + (window_n / 3) * 520.0f));
+        ImGui::SetNextWindowSize(ImVec2(600, 500));
+        ImGui::Begin(window_name);
+        for (int job_n = 0; job_n < DRAWLIST_JOBS_PER_WINDOW; job_n++)
+        {
+            DrawListJobData* data = &g_DrawListJobsData[window_n * DRAWLIST_JOBS_PER_WINDOW + job_n];
+            data->Frame = frame;
+            data->Index = window_n * DRAWLIST_JOBS_PER_WINDOW + job_n;
+            data->Pos = ImVec2(ImGui::GetCursorScreenPos().x + (job_n % 4) * 145.0f, ImGui::GetCursorScreenPos().y + 14.0f + (job_n / 4) * 115.0f);
+            ImGui::AddDrawListJob(DrawListJobCallback, data);
+        }
+        ImGui::Text("Window %d", window_n);
+        ImGui::End();
+    }
+}
+
+// FNV-1a of the vertices and indices of all draw lists, to compare the serial and threaded outputs
+static unsigned int HashDrawData(const ImDrawData* draw_data)
+{
+    unsigned int hash = 2166136261u;
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
     {
-        printf("NewFrame() %d\n", n);
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        const unsigned char* bytes[2] = { (const unsigned char*)draw_list->VtxBuffer.Data, (const unsigned char*)draw_list->IdxBuffer.Data };
+        const int sizes[2] = { draw_list->VtxBuffer.size_in_bytes(), draw_list->IdxBuffer.size_in_bytes() };
+        for (int buf_n = 0; buf_n < 2; buf_n++)
+            for (int i = 0; i < sizes[buf_n]; i++)
+                hash = (hash ^ bytes[buf_n][i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Runs the same frames with jobs run serially, then on DRAWLIST_JOBS_THREADS_COUNT threads, and checks that:
+// - the draw data is identical for each frame,
+// - io.MetricsActiveAllocations tracks the allocator exactly (job allocations are counted without races).
+// Outputs drawlist_jobs_serial/drawlist_jobs_threads lines, errors go to stderr.
+static void RunDrawListJobsWorkload(ImFontAtlas* atlas, int warmup_frames, int frames)
+{
+    ImVector<unsigned int> serial_hashes;
+    int errors = 0;
+    for (int mode = 0; mode < 2; mode++)
+    {
+        ImGui::CreateContext(atlas);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
         io.DisplaySize = ImVec2(1920, 1080);
         io.DeltaTime = 1.0f / 60.0f;
-        ImGui::NewFrame();
+        io.DrawListJobsDispatchFn = (mode == 1) ? DrawListJobsDispatchThreads : NULL;
 
-        static float f = 0.0f;
-        ImGui::Text("Hello, world!");
-        ImGui::SliderFloat("float", &f, 0.0f, 1.0f);
-        ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
-        ImGui::ShowDemoWindow(NULL);
+        double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+        size_t vtx_total = 0, idx_total = 0, cmd_total = 0, alloc_count_total = 0, alloc_bytes_total = 0;
+        for (int n = 0; n < warmup_frames + frames; n++)
+        {
+            const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+            const long long live_allocs_start = (long long)g_AllocCount - (long long)g_FreeCount;
+            const int metrics_allocs_start = io.MetricsActiveAllocations;
+            const double t0 = GetTimeNs();
+            ImGui::NewFrame();
+            SubmitDrawListJobs(n);
+            ImGui::Render();
+            const double t = GetTimeNs() - t0;
 
-        ImGui::Render();
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            const unsigned int hash = HashDrawData(draw_data);
+            if (mode == 0)
+                serial_hashes.push_back(hash);
+            else if (hash != serial_hashes[n])
+                errors++, fprintf(stderr, "drawlist_jobs: frame %d: threaded output differs from serial output!\n", n);
+            const long long live_allocs_delta = (long long)g_AllocCount - (long long)g_FreeCount - live_allocs_start;
+            if (live_allocs_delta != (long long)(io.MetricsActiveAllocations - metrics_allocs_start))
+                errors++, fprintf(stderr, "drawlist_jobs: frame %d: io.MetricsActiveAllocations changed by %d, allocator by %lld!\n", n, io.MetricsActiveAllocations - metrics_allocs_start, live_allocs_delta);
+            if (n < warmup_frames)
+                continue;
+
+            time_total += t;
+            time_min = t < time_min ? t : time_min;
+            time_max = t > time_max ? t : time_max;
+            vtx_total += draw_data->TotalVtxCount;
+            idx_total += draw_data->TotalIdxCount;
+            for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+                cmd_total += draw_data->CmdLists[list_n]->CmdBuffer.Size;
+            alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+            alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+        }
+        ImGui::DestroyContext();
+
+        printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", mode == 0 ? "drawlist_jobs_serial" : "drawlist_jobs_threads", frames,
+            time_total / frames, time_min, time_max,
+            (double)vtx_total / frames, (double)idx_total / frames, (double)cmd_total / frames,
+            (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+        fflush(stdout);
+    }
+    fprintf(stderr, "drawlist_jobs: %d jobs per frame on %d threads, %d errors\n", DRAWLIST_JOBS_WINDOWS_COUNT * DRAWLIST_JOBS_PER_WINDOW, DRAWLIST_JOBS_THREADS_COUNT, errors);
+}
+
+//-----------------------------------------------------------------------------
+// Content hash workload: cost of ImGuiBackendFlags_RendererHasContentHash vs uploading the draw data
+//-----------------------------------------------------------------------------
+
+// Runs the demo_window and text_heavy workloads together, timing Render() alone without then with ImGuiBackendFlags_RendererHasContentHash,
+// and the copy of all vertex/index buffers into a staging buffer, which is what hashing lets back-ends skip for unchanged lists.
+// Outputs render_no_content_hash/render_content_hash/draw_data_upload lines, the comparison goes to stderr.
+static void RunContentHashWorkload(ImFontAtlas* atlas, int warmup_frames, int frames)
+{
+    double render_time_min[2] = { 0.0, 0.0 };
+    double upload_time_total = 0.0, upload_time_min = 1e30, upload_time_max = 0.0;
+    ImVector<char> staging_buffer;
+    for (int mode = 0; mode < 2; mode++)
+    {
+        ImGui::CreateContext(atlas);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;
+        if (mode == 1)
+            io.BackendFlags |= ImGuiBackendFlags_RendererHasContentHash;
+
+        double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+        size_t vtx_total = 0, idx_total = 0, cmd_total = 0, alloc_count_total = 0, alloc_bytes_total = 0;
+        for (int n = 0; n < warmup_frames + frames; n++)
+        {
+            ImGui::NewFrame();
+            WorkloadDemoWindow(n);
+            WorkloadTextHeavy(n);
+            const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+            const double t0 = GetTimeNs();
+            ImGui::Render();
+            const double t = GetTimeNs() - t0;
+
+            ImDrawData* draw_data = ImGui::GetDrawData();
+            staging_buffer.resize((int)(draw_data->TotalVtxCount * sizeof(ImDrawVert) + draw_data->TotalIdxCount * sizeof(ImDrawIdx)));
+            const double upload_t0 = GetTimeNs();
+            char* staging_ptr = staging_buffer.Data;
+            for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+            {
+                const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+                memcpy(staging_ptr, draw_list->VtxBuffer.Data, draw_list->VtxBuffer.Size * sizeof(ImDrawVert));
+                staging_ptr += draw_list->VtxBuffer.Size * sizeof(ImDrawVert);
+                memcpy(staging_ptr, draw_list->IdxBuffer.Data, draw_list->IdxBuffer.Size * sizeof(ImDrawIdx));
+                staging_ptr += draw_list->IdxBuffer.Size * sizeof(ImDrawIdx);
+            }
+            const double upload_t = GetTimeNs() - upload_t0;
+            if (n < warmup_frames)
+                continue;
+
+            time_total += t;
+            time_min = t < time_min ? t : time_min;
+            time_max = t > time_max ? t : time_max;
+            if (mode == 0)
+            {
+                upload_time_total += upload_t;
+                upload_time_min = upload_t < upload_time_min ? upload_t : upload_time_min;
+                upload_time_max = upload_t > upload_time_max ? upload_t : upload_time_max;
+            }
+            vtx_total += draw_data->TotalVtxCount;
+            idx_total += draw_data->TotalIdxCount;
+            for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+                cmd_total += draw_data->CmdLists[list_n]->CmdBuffer.Size;
+            alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+            alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+        }
+        ImGui::DestroyContext();
+
+        render_time_min[mode] = time_min;
+        printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", mode == 0 ? "render_no_content_hash" : "render_content_hash", frames,
+            time_total / frames, time_min, time_max,
+            (double)vtx_total / frames, (double)idx_total / frames, (double)cmd_total / frames,
+            (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+        if (mode == 0)
+            printf("draw_data_upload,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", frames,
+                upload_time_total / frames, upload_time_min, upload_time_max,
+                (double)vtx_total / frames, (double)idx_total / frames, (double)cmd_total / frames, 0.0, 0.0);
+        fflush(stdout);
+    }
+    fprintf(stderr, "content_hash: hashing adds %.0f ns to Render(), copying the buffers takes %.0f ns (best frames)\n", render_time_min[1] - render_time_min[0], upload_time_min);
+}
+
+//-----------------------------------------------------------------------------
+// Storage workloads: sorted ImGuiStorage vs hashed (io.ConfigStorageUseHashMap)
+//-----------------------------------------------------------------------------
+
+static void PrintStorageWorkloadResult(const char* name, int keys_count, int frames, double time_total, double time_min, double time_max, size_t alloc_count_total, size_t alloc_bytes_total)
+{
+    char full_name[64];
+    sprintf(full_name, "%s_%dk", name, keys_count / 1000);
+    printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", full_name, frames,
+        time_total / frames, time_min, time_max, 0.0, 0.0, 0.0,
+        (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+    fflush(stdout);
+}
+
+// Insert 'keys_count' random keys in an empty storage (one "frame" per fill), then query them all in another random order (one "frame" per pass).
+// Outputs storage_{sorted|hashed}_{insert|query}_{N}k lines.
+static void RunStorageWorkload(ImFontAtlas* atlas, int keys_count, bool use_hash_map, int frames)
+{
+    ImGui::CreateContext(atlas);
+    ImGui::GetIO().IniFilename = NULL;
+    ImGui::GetIO().ConfigStorageUseHashMap = use_hash_map;
+
+    // Distinct pseudo-random keys (odd multiplier is a bijection on 32-bit integers), queried in a different order
+    ImVector<ImGuiID> keys, query_keys;
+    keys.resize(keys_count);
+    query_keys.resize(keys_count);
+    for (int n = 0; n < keys_count; n++)
+    {
+        keys[n] = (ImGuiID)n * 2654435761u + 12345u;
+        query_keys[n] = (ImGuiID)((n * 7919) % keys_count) * 2654435761u + 12345u;
+    }
+
+    double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+    size_t alloc_count_total = 0, alloc_bytes_total = 0;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        ImGuiStorage storage;
+        const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < keys_count; n++)
+            storage.SetInt(keys[n], n);
+        const double t = GetTimeNs() - t0;
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
+        alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+        alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+    }
+    PrintStorageWorkloadResult(use_hash_map ? "storage_hashed_insert" : "storage_sorted_insert", keys_count, frames, time_total, time_min, time_max, alloc_count_total, alloc_bytes_total);
+
+    ImGuiStorage storage;
+    for (int n = 0; n < keys_count; n++)
+        storage.SetInt(keys[n], n);
+    time_total = 0.0; time_min = 1e30; time_max = 0.0;
+    int errors = 0;
+    for (int frame = 0; frame < frames; frame++)
+    {
+        const double t0 = GetTimeNs();
+        for (int n = 0; n < keys_count; n++)
+            if (storage.GetInt(query_keys[n], -1) != (n * 7919) % keys_count)
+                errors++;
+        const double t = GetTimeNs() - t0;
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
+    }
+    PrintStorageWorkloadResult(use_hash_map ? "storage_hashed_query" : "storage_sorted_query", keys_count, frames, time_total, time_min, time_max, 0, 0);
+    if (errors > 0)
+        fprintf(stderr, "storage: %d wrong query results!\n", errors);
+
+    ImGui::DestroyContext();
+}
+
+//-----------------------------------------------------------------------------
+// Hovered window workloads: FindHoveredWindow() with the windows hit grid vs the linear scan, and the grid re-bin cost
+//-----------------------------------------------------------------------------
+
+enum HoveredWindowMode
+{
+    HoveredWindowMode_Grid,         // Windows don't move, FindHoveredWindow() uses the grid built by the last EndFrame()
+    HoveredWindowMode_Linear,       // Same frames, but the grid is invalidated before NewFrame() so FindHoveredWindow() scans every window
+    HoveredWindowMode_Moving,       // All windows move every frame, so EndFrame() re-bins the grid
+    HoveredWindowMode_COUNT
+};
+
+// Submit 'windows_count' windows tiled across the display with small gaps (e.g. a node editor), with the mouse at a pseudo-random position every frame:
+// the linear scan then finds windows at any depth in the display order, and scans every window when the mouse is in a gap.
+// Outputs hovered_window_{N}_grid/hovered_window_{N}_linear lines timing NewFrame() alone, and hovered_window_{N}_moving timing Render() alone.
+static void RunHoveredWindowWorkload(ImFontAtlas* atlas, int windows_count, int warmup_frames, int frames)
+{
+    char name_prefix[32];
+    if (windows_count >= 1000)
+        sprintf(name_prefix, "hovered_window_%dk", windows_count / 1000);
+    else
+        sprintf(name_prefix, "hovered_window_%d", windows_count);
+
+    // Tiles in a pseudo-random order, so the display order doesn't follow the layout
+    const int columns = (int)ceilf(sqrtf(windows_count * 16.0f / 9.0f));
+    const int rows = (windows_count + columns - 1) / columns;
+    const ImVec2 tile_size(1920.0f / columns, 1080.0f / rows);
+    ImVector<ImVec2> windows_pos;
+    windows_pos.resize(windows_count);
+    for (int n = 0; n < windows_count; n++)
+    {
+        const int tile_n = (int)(((unsigned int)n * 2654435761u) % (unsigned int)(columns * rows));
+        windows_pos[n] = ImVec2((tile_n % columns) * tile_size.x, (tile_n / columns) * tile_size.y);
+    }
+    const ImVec2 window_size(tile_size.x - 2.0f, tile_size.y - 2.0f);
+
+    double time_avg[HoveredWindowMode_COUNT], render_time_avg[HoveredWindowMode_COUNT];
+    ImVector<ImGuiID> hovered_ids[2];
+    for (int mode = 0; mode < HoveredWindowMode_COUNT; mode++)
+    {
+        ImGui::CreateContext(atlas);
+        ImGuiIO& io = ImGui::GetIO();
+        io.IniFilename = NULL;
+        io.DisplaySize = ImVec2(1920, 1080);
+        io.DeltaTime = 1.0f / 60.0f;
+        ImGui::GetStyle().WindowMinSize = ImVec2(1.0f, 1.0f);
+
+        double time_total = 0.0, time_min = 1e30, time_max = 0.0, render_time_total = 0.0;
+        size_t alloc_count_total = 0, alloc_bytes_total = 0;
+        unsigned int mouse_rand_state = 6789u;
+        for (int frame = 0; frame < warmup_frames + frames; frame++)
+        {
+            mouse_rand_state = mouse_rand_state * 1664525u + 1013904223u;
+            io.MousePos = ImVec2((float)((mouse_rand_state >> 8) % 1920), (float)((mouse_rand_state >> 20) % 1080));
+            if (mode == HoveredWindowMode_Linear)
+                ImGui::GetCurrentContext()->WindowsHitGrid.FrameCount = -1;
+
+            const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+            const double t0 = GetTimeNs();
+            ImGui::NewFrame();
+            const double new_frame_t = GetTimeNs() - t0;
+            if (mode != HoveredWindowMode_Moving && frame >= warmup_frames)
+                hovered_ids[mode].push_back(ImGui::GetCurrentContext()->HoveredWindow ? ImGui::GetCurrentContext()->HoveredWindow->ID : 0);
+
+            char window_name[32];
+            const float offset_x = (mode == HoveredWindowMode_Moving) ? (float)(frame % 8) : 0.0f;
+            const float offset_y = (mode == HoveredWindowMode_Moving) ? (float)(frame % 5) : 0.0f;
+            for (int n = 0; n < windows_count; n++)
+            {
+                sprintf(window_name, "##window%d", n);
+                ImGui::SetNextWindowPos(ImVec2(windows_pos[n].x + offset_x, windows_pos[n].y + offset_y));
+                ImGui::SetNextWindowSize(window_size);
+                ImGui::Begin(window_name, NULL, ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoFocusOnAppearing);
+                ImGui::End();
+            }
+
+            const double render_t0 = GetTimeNs();
+            ImGui::Render();
+            const double render_t = GetTimeNs() - render_t0;
+            if (frame < warmup_frames)
+                continue;
+
+            const double t = (mode == HoveredWindowMode_Moving) ? render_t : new_frame_t;
+            time_total += t;
+            time_min = t < time_min ? t : time_min;
+            time_max = t > time_max ? t : time_max;
+            render_time_total += render_t;
+            alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+            alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+        }
+        ImGui::DestroyContext();
+        time_avg[mode] = time_total / frames;
+        render_time_avg[mode] = render_time_total / frames;
+
+        static const char* mode_names[HoveredWindowMode_COUNT] = { "grid", "linear", "moving" };
+        printf("%s_%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", name_prefix, mode_names[mode], frames,
+            time_total / frames, time_min, time_max, 0.0, 0.0, 0.0,
+            (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+        fflush(stdout);
+    }
+
+    int mismatches = 0;
+    for (int n = 0; n < hovered_ids[0].Size; n++)
+        if (hovered_ids[0][n] != hovered_ids[1][n])
+            mismatches++;
+    fprintf(stderr, "%s: NewFrame() takes %.0f ns with the grid, %.0f ns with the linear scan, re-binning moving windows adds %.0f ns to Render() (averages), %d mismatches\n",
+        name_prefix, time_avg[HoveredWindowMode_Grid], time_avg[HoveredWindowMode_Linear], render_time_avg[HoveredWindowMode_Moving] - render_time_avg[HoveredWindowMode_Grid], mismatches);
+}
+
+//-----------------------------------------------------------------------------
+// Hash workloads: ImHashStr()/ImHashData() as used for IDs, with whichever implementation imconfig.h selects
+//-----------------------------------------------------------------------------
+
+#if defined(IMGUI_USE_CRC32C_SSE42)
+static const char* g_HashImplName = "CRC32C SSE4.2";
+#elif defined(IMGUI_USE_CRC32_SLICE_BY_8)
+static const char* g_HashImplName = "CRC32 slice-by-8";
+#else
+static const char* g_HashImplName = "CRC32";
+#endif
+static ImU32 g_HashSink = 0;    // Keep the compiler from discarding hashes
+
+static int CompareHashIDs(const void* lhs, const void* rhs)
+{
+    const ImGuiID a = *(const ImGuiID*)lhs, b = *(const ImGuiID*)rhs;
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+
+// Hash all labels of a zero-separated list (one "frame" per pass over the list, as ImGui::GetID() would with a zero-terminated label).
+// Outputs one hash_str_{name} line, the cost per label goes to stderr.
+static void RunHashStrWorkload(const char* name, const ImVector<char>& labels, int labels_count, int warmup_frames, int frames)
+{
+    double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+    for (int frame = 0; frame < warmup_frames + frames; frame++)
+    {
+        const double t0 = GetTimeNs();
+        ImU32 hash_acc = 0;
+        for (const char* label = labels.Data; label < labels.Data + labels.Size; label += strlen(label) + 1)
+            hash_acc ^= ImHashStr(label, 0, 0x12345678);
+        const double t = GetTimeNs() - t0;
+        g_HashSink ^= hash_acc;
+        if (frame < warmup_frames)
+            continue;
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
     }
+    printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", name, frames, time_total / frames, time_min, time_max, 0.0, 0.0, 0.0, 0.0, 0.0);
+    fflush(stdout);
+    fprintf(stderr, "%s: %.2f ns per label (best frame, %d labels, %s)\n", name, time_min / labels_count, labels_count, g_HashImplName);
+}
+
+// Hash every key of a printf-style key set as IDs in the same window would be, and count IDs shared by different keys.
+// Outputs one hash_collisions_{name} line timing the whole set including formatting keys (one frame), the collision count goes to stderr.
+static void RunHashCollisionsWorkload(const char* name, const char* key_fmt, int keys_count)
+{
+    ImVector<ImGuiID> ids;
+    ids.resize(keys_count);
+    char key[64];
+    const double t0 = GetTimeNs();
+    for (int n = 0; n < keys_count; n++)
+    {
+        sprintf(key, key_fmt, n);
+        ids[n] = ImHashStr(key, 0, 0x12345678);
+    }
+    const double t = GetTimeNs() - t0;
+    qsort(ids.Data, (size_t)ids.Size, sizeof(ImGuiID), CompareHashIDs);
+    int collisions = 0;
+    for (int n = 1; n < ids.Size; n++)
+        if (ids[n] == ids[n - 1])
+            collisions++;
+    printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", name, 1, t, t, t, 0.0, 0.0, 0.0, 0.0, 0.0);
+    fflush(stdout);
+    const double expected_collisions = (double)keys_count * (keys_count - 1) / (2.0 * 4294967296.0);
+    fprintf(stderr, "%s: %d collisions over %d \"%s\" keys (%.1f expected from an ideal 32-bit hash, %s)\n", name, collisions, keys_count, key_fmt, expected_collisions, g_HashImplName);
+}
 
-    printf("DestroyContext()\n");
+// Outputs hash_str_short/hash_str_triple_hash/hash_data_1mb/hash_collisions_item/hash_collisions_node lines.
+static void RunHashWorkloads(const char* filter, int warmup_frames, int frames)
+{
+    const int LABELS_COUNT = 1000;
+    if (filter == NULL || strstr("hash_str_short", filter) != NULL)
+    {
+        // Typical widget labels, most of them shorter than 8 bytes
+        static const char* short_labels[] = { "Button", "OK", "Cancel", "Apply", "##value", "Checkbox", "Item 42", "Color", "Slider float", "##hidden", "Open", "Save" };
+        ImVector<char> labels;
+        for (int n = 0; n < LABELS_COUNT; n++)
+        {
+            const char* label = short_labels[n % IM_ARRAYSIZE(short_labels)];
+            for (const char* p = label; p <= label + strlen(label); p++)
+                labels.push_back(*p);
+        }
+        RunHashStrWorkload("hash_str_short", labels, LABELS_COUNT, warmup_frames, frames);
+    }
+    if (filter == NULL || strstr("hash_str_triple_hash", filter) != NULL)
+    {
+        // "label###id" labels, where only "###id" is hashed
+        ImVector<char> labels;
+        char label[64];
+        for (int n = 0; n < LABELS_COUNT; n++)
+        {
+            sprintf(label, "Frame %d (%.2f ms)###PerformanceWindow%d", n * 7, n * 0.0167f, n % 4);
+            for (const char* p = label; p <= label + strlen(label); p++)
+                labels.push_back(*p);
+        }
+        RunHashStrWorkload("hash_str_triple_hash", labels, LABELS_COUNT, warmup_frames, frames);
+    }
+    if (filter == NULL || strstr("hash_data_1mb", filter) != NULL)
+    {
+        const int data_size = 1024 * 1024;
+        ImVector<unsigned char> data;
+        data.resize(data_size);
+        for (int n = 0; n < data_size; n++)
+            data[n] = (unsigned char)((n * 2654435761u) >> 24);
+        double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+        for (int frame = 0; frame < warmup_frames + frames; frame++)
+        {
+            const double t0 = GetTimeNs();
+            g_HashSink ^= ImHashData(data.Data, (size_t)data.Size, 0);
+            const double t = GetTimeNs() - t0;
+            if (frame < warmup_frames)
+                continue;
+            time_total += t;
+            time_min = t < time_min ? t : time_min;
+            time_max = t > time_max ? t : time_max;
+        }
+        printf("hash_data_1mb,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", frames, time_total / frames, time_min, time_max, 0.0, 0.0, 0.0, 0.0, 0.0);
+        fflush(stdout);
+        fprintf(stderr, "hash_data_1mb: %.0f MB/s (best frame, %s)\n", data_size / time_min * 1000.0 * 1000.0 * 1000.0 / (1024.0 * 1024.0), g_HashImplName);
+    }
+    if (filter == NULL || strstr("hash_collisions_item", filter) != NULL)
+        RunHashCollisionsWorkload("hash_collisions_item", "Item %d", 1000000);
+    if (filter == NULL || strstr("hash_collisions_node", filter) != NULL)
+        RunHashCollisionsWorkload("hash_collisions_node", "##node%d", 1000000);
+}
+
+//-----------------------------------------------------------------------------
+
+static void RunWorkload(const Workload& workload, ImFontAtlas* atlas, int warmup_frames, int frames, bool glyph_run_cache)
+{
+    ImGui::CreateContext(atlas);
+    ImGuiIO& io = ImGui::GetIO();
+    io.ConfigTextGlyphRunCache = glyph_run_cache;
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1920, 1080);
+    io.DeltaTime = 1.0f / 60.0f;
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset; // Like most of our renderers, allow draw lists with 64K+ vertices
+
+    double time_total = 0.0, time_min = 1e30, time_max = 0.0;
+    size_t vtx_total = 0, idx_total = 0, cmd_total = 0, alloc_count_total = 0, alloc_bytes_total = 0;
+    for (int n = 0; n < warmup_frames + frames; n++)
+    {
+        const size_t alloc_count_start = (size_t)g_AllocCount, alloc_bytes_start = (size_t)g_AllocBytes;
+        const double t0 = GetTimeNs();
+        ImGui::NewFrame();
+        workload.Func(n);
+        ImGui::Render();
+        const double t = GetTimeNs() - t0;
+        if (n < warmup_frames)
+            continue;
+
+        time_total += t;
+        time_min = t < time_min ? t : time_min;
+        time_max = t > time_max ? t : time_max;
+        ImDrawData* draw_data = ImGui::GetDrawData();
+        vtx_total += draw_data->TotalVtxCount;
+        idx_total += draw_data->TotalIdxCount;
+        for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+            cmd_total += draw_data->CmdLists[list_n]->CmdBuffer.Size;
+        alloc_count_total += (size_t)g_AllocCount - alloc_count_start;
+        alloc_bytes_total += (size_t)g_AllocBytes - alloc_bytes_start;
+    }
     ImGui::DestroyContext();
+    if (workload.Shutdown)
+        workload.Shutdown();
+
+    printf("%s,%d,%.0f,%.0f,%.0f,%.1f,%.1f,%.1f,%.2f,%.1f\n", workload.Name, frames,
+        time_total / frames, time_min, time_max,
+        (double)vtx_total / frames, (double)idx_total / frames, (double)cmd_total / frames,
+        (double)alloc_count_total / frames, (double)alloc_bytes_total / frames);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv)
+{
+    int frames = 200;
+    int warmup_frames = 20;
+    const char* filter = NULL;
+    const char* fonts_dir = "../../misc/fonts";
+    bool glyph_run_cache = false;
+    for (int n = 1; n < argc; n++)
+    {
+        if (strcmp(argv[n], "--frames") == 0 && n + 1 < argc)
+            frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--warmup") == 0 && n + 1 < argc)
+            warmup_frames = atoi(argv[++n]);
+        else if (strcmp(argv[n], "--filter") == 0 && n + 1 < argc)
+            filter = argv[++n];
+        else if (strcmp(argv[n], "--glyph-run-cache") == 0)
+            glyph_run_cache = true;
+        else if (strcmp(argv[n], "--fonts-dir") == 0 && n + 1 < argc)
+            fonts_dir = argv[++n];
+        else
+        {
+            fprintf(stderr, "Usage: %s [--frames N] [--warmup N] [--filter substring] [--glyph-run-cache] [--fonts-dir path]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (frames < 1)
+        frames = 1;
+
+    IMGUI_CHECKVERSION();
+    ImGui::SetAllocatorFunctions(CountingAlloc, CountingFree);
+
+    // Build atlas once, shared by all contexts
+    ImFontAtlas* atlas = new ImFontAtlas();
+    unsigned char* tex_pixels = NULL;
+    int tex_w, tex_h;
+    atlas->GetTexDataAsRGBA32(&tex_pixels, &tex_w, &tex_h);
+
+    printf("workload,frames,ns_per_frame,ns_per_frame_min,ns_per_frame_max,vertices_per_frame,indices_per_frame,draw_cmds_per_frame,allocs_per_frame,alloc_bytes_per_frame\n");
+    for (int n = 0; n < (int)(sizeof(g_Workloads) / sizeof(g_Workloads[0])); n++)
+        if (filter == NULL || strstr(g_Workloads[n].Name, filter) != NULL)
+            RunWorkload(g_Workloads[n], atlas, warmup_frames, frames, glyph_run_cache);
+    if (filter == NULL || strstr("drawlist_polyline", filter) != NULL)
+        RunPolylineWorkload(atlas, warmup_frames, frames);
+    if (filter == NULL || strstr("drawlist_jobs_serial,drawlist_jobs_threads", filter) != NULL)
+        RunDrawListJobsWorkload(atlas, warmup_frames, frames);
+    if (filter == NULL || strstr("render_no_content_hash,render_content_hash,draw_data_upload", filter) != NULL)
+        RunContentHashWorkload(atlas, warmup_frames, frames);
+
+    // Storage workloads at 1K/10K/100K keys. Fewer frames for more keys, as sorted insertions are O(N) each
+    if (filter == NULL || strstr("storage_sorted_insert,storage_sorted_query,storage_hashed_insert,storage_hashed_query", filter) != NULL)
+        for (int keys_count = 1000; keys_count <= 100000; keys_count *= 10)
+        {
+            const int storage_frames = frames * 1000 / keys_count > 1 ? frames * 1000 / keys_count : 1;
+            RunStorageWorkload(atlas, keys_count, false, storage_frames);
+            RunStorageWorkload(atlas, keys_count, true, storage_frames);
+        }
+
+    // Hovered window workloads at 100/1K/10K windows. Fewer frames for more windows, as every window is submitted each frame
+    if (filter == NULL || strstr("hovered_window_100_grid,hovered_window_1k_linear,hovered_window_10k_moving", filter) != NULL)
+        for (int windows_count = 100; windows_count <= 10000; windows_count *= 10)
+        {
+            const int windows_frames = frames * 100 / windows_count > 20 ? frames * 100 / windows_count : 20;
+            const int windows_warmup_frames = warmup_frames < 10 ? warmup_frames : 10;
+            RunHoveredWindowWorkload(atlas, windows_count, windows_warmup_frames, windows_frames);
+        }
+    RunHashWorkloads(filter, warmup_frames, frames);
+
+    // Font atlas builds are much longer than frames
+    const int build_frames = frames / 20 > 1 ? frames / 20 : 1;
+    if (filter == NULL || strstr("font_atlas_build", filter) != NULL)
+        RunFontAtlasBuildWorkload("font_atlas_build", fonts_dir, FontAtlasBuildMode_Serial, build_frames);
+    if (filter == NULL || strstr("font_atlas_build_parallel", filter) != NULL)
+        RunFontAtlasBuildWorkload("font_atlas_build_parallel", fonts_dir, FontAtlasBuildMode_Parallel, build_frames);
+    if (filter == NULL || strstr("font_atlas_load_cache", filter) != NULL)
+        RunFontAtlasBuildWorkload("font_atlas_load_cache", fonts_dir, FontAtlasBuildMode_Cache, build_frames);
+
+    delete atlas;
     return 0;
 }
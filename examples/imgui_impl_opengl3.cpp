@@ -4,6 +4,8 @@
 
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID in imgui.cpp.
+//  [X] Renderer: Signed distance field fonts (ImFontConfig::SignedDistanceField), drawn with a second shader when io.Fonts->TexIDSDF is used.
+//  [X] Renderer: Persistent vertex/index buffers per ImDrawList, only uploaded when ImDrawList::ContentGeneration changes (ImGuiBackendFlags_RendererHasContentHash).
 
 // You can copy and use unmodified imgui_impl_* files in your project. See main.cpp for an example of using this.
 // If you are new to dear imgui, read examples/README.txt and read the documentation at the top of imgui.cpp.
@@ -11,6 +13,10 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2019-02-24: OpenGL: Keep vertex/index buffers per draw list and skip uploading unchanged lists, enable ImGuiBackendFlags_RendererHasContentHash flag.
+//  2019-02-22: OpenGL: Added a distance field shader for fonts using ImFontConfig::SignedDistanceField, setting io.Fonts->TexIDSDF.
+//  2019-02-20: OpenGL: Upload the font atlas regions listed in io.Fonts->TexDirtyRects (ImFontAtlasFlags_DynamicGlyphs).
+//  2019-02-11: OpenGL: Added support for large meshes (64K+ vertices) using glDrawElementsBaseVertex() on GL 3.2+, enable ImGuiBackendFlags_RendererHasVtxOffset flag.
 //  2019-02-01: OpenGL: Using GLSL 410 shaders for any version over 410 (e.g. 430, 450).
 //  2018-11-30: Misc: Setting up io.BackendRendererName so it can be displayed in the About Window.
 //  2018-11-13: OpenGL: Support for GL 4.5's glClipControl(GL_UPPER_LEFT).
@@ -91,20 +97,51 @@
 #endif
 #endif
 
+// Desktop GL 3.2+ has glDrawElementsBaseVertex() which allows us to honor ImDrawCmd::VtxOffset (GL ES 3 headers don't expose it)
+#ifndef USE_GL_ES3
+#define IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+#endif
+
 // OpenGL Data
+static GLuint       g_GlVersion = 0;                // Extracted at runtime using GL_MAJOR_VERSION, GL_MINOR_VERSION queries (e.g. 320 for GL 3.2)
 static char         g_GlslVersionString[32] = "";
 static GLuint       g_FontTexture = 0;
 static GLuint       g_ShaderHandle = 0, g_VertHandle = 0, g_FragHandle = 0;
+static GLuint       g_ShaderHandleSDF = 0, g_FragHandleSDF = 0;
+static int          g_AttribLocationTexSDF = 0, g_AttribLocationProjMtxSDF = 0;
 static int          g_AttribLocationTex = 0, g_AttribLocationProjMtx = 0;
 static int          g_AttribLocationPosition = 0, g_AttribLocationUV = 0, g_AttribLocationColor = 0;
 static unsigned int g_VboHandle = 0, g_ElementsHandle = 0;
 
+// Vertex/index buffers kept for each ImDrawList rendered during the last frame, uploaded again only when the list content changes.
+// We also compare ContentHash, as a destroyed list may be replaced by a new one at the same address and with the same ContentGeneration.
+struct ImGui_ImplOpenGL3_DrawListBuffers
+{
+    const ImDrawList*   DrawList;
+    unsigned int        ContentGeneration;
+    ImU64               ContentHash;
+    int                 LastFrameUsed;
+    GLuint              VboHandle, ElementsHandle;
+};
+static ImVector<ImGui_ImplOpenGL3_DrawListBuffers> g_DrawListBuffers;
+
 // Functions
 bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
 {
     ImGuiIO& io = ImGui::GetIO();
     io.BackendRendererName = "imgui_impl_opengl3";
 
+    // Query for GL version, and setup back-end capabilities flags
+    GLint major = 0, minor = 0;
+    glGetIntegerv(GL_MAJOR_VERSION, &major);
+    glGetIntegerv(GL_MINOR_VERSION, &minor);
+    g_GlVersion = (GLuint)(major * 100 + minor * 10);
+#ifdef IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+    if (g_GlVersion >= 320)
+        io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+#endif
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasContentHash;    // We keep buffers per draw list and only upload the ones whose ImDrawList::ContentGeneration changed.
+
     // Store GLSL version string so we can refer to it later in case we recreate shaders. Note: GLSL version is NOT the same as GL version. Leave this to NULL if unsure.
 #ifdef USE_GL_ES3
     if (glsl_version == NULL)
@@ -131,6 +168,88 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
 }
 
+// Upload the font atlas regions modified since last frame (ImFontAtlasFlags_DynamicGlyphs rasterize glyphs on demand).
+// We upload the union of the modified rows in a single call.
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexDirtyRects.empty() || !g_FontTexture)
+        return;
+    unsigned char* pixels;
+    int width, height;
+    atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+    int y0 = height, y1 = 0;
+    for (int n = 0; n < atlas->TexDirtyRects.Size; n++)
+    {
+        const ImFontAtlas::DirtyRect& r = atlas->TexDirtyRects[n];
+        y0 = (r.Y < y0) ? r.Y : y0;
+        y1 = (r.Y + r.Height > y1) ? r.Y + r.Height : y1;
+    }
+    atlas->TexDirtyRects.clear();
+    glBindTexture(GL_TEXTURE_2D, g_FontTexture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y0, width, y1 - y0, GL_RGBA, GL_UNSIGNED_BYTE, pixels + y0 * width * 4);
+}
+
+static void ImGui_ImplOpenGL3_SetupVertexAttribs()
+{
+    glVertexAttribPointer(g_AttribLocationPosition, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
+    glVertexAttribPointer(g_AttribLocationUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
+    glVertexAttribPointer(g_AttribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+}
+
+// Bind the buffers kept for this draw list, uploading its content if it changed since we last rendered it (ImGuiBackendFlags_RendererHasContentHash).
+static void ImGui_ImplOpenGL3_BindDrawListBuffers(const ImDrawList* cmd_list)
+{
+    const int frame_count = ImGui::GetFrameCount();
+    ImGui_ImplOpenGL3_DrawListBuffers* buffers = NULL;
+    for (int n = 0; n < g_DrawListBuffers.Size && buffers == NULL; n++)
+        if (g_DrawListBuffers[n].DrawList == cmd_list)
+            buffers = &g_DrawListBuffers[n];
+    bool upload = false;
+    if (buffers == NULL)
+    {
+        g_DrawListBuffers.resize(g_DrawListBuffers.Size + 1);
+        buffers = &g_DrawListBuffers.back();
+        buffers->DrawList = cmd_list;
+        glGenBuffers(1, &buffers->VboHandle);
+        glGenBuffers(1, &buffers->ElementsHandle);
+        upload = true;
+    }
+    upload |= (buffers->ContentGeneration != cmd_list->ContentGeneration || buffers->ContentHash != cmd_list->ContentHash);
+    buffers->ContentGeneration = cmd_list->ContentGeneration;
+    buffers->ContentHash = cmd_list->ContentHash;
+    buffers->LastFrameUsed = frame_count;
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffers->VboHandle);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers->ElementsHandle);
+    if (upload)
+    {
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_DYNAMIC_DRAW);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_DYNAMIC_DRAW);
+    }
+    ImGui_ImplOpenGL3_SetupVertexAttribs();
+}
+
+// Delete the buffers of draw lists which weren't rendered this frame (e.g. closed or hidden windows)
+static void ImGui_ImplOpenGL3_GarbageCollectDrawListBuffers(bool all)
+{
+    const int frame_count = ImGui::GetFrameCount();
+    int n_kept = 0;
+    for (int n = 0; n < g_DrawListBuffers.Size; n++)
+    {
+        ImGui_ImplOpenGL3_DrawListBuffers& buffers = g_DrawListBuffers[n];
+        if (!all && buffers.LastFrameUsed == frame_count)
+        {
+            g_DrawListBuffers[n_kept++] = buffers;
+            continue;
+        }
+        glDeleteBuffers(1, &buffers.VboHandle);
+        glDeleteBuffers(1, &buffers.ElementsHandle);
+    }
+    g_DrawListBuffers.resize(n_kept);
+}
+
 // OpenGL3 Render function.
 // (this used to be set in io.RenderDrawListsFn and called by ImGui::Render(), but you can now call this directly from your main loop)
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly, in order to be able to run within any OpenGL engine that doesn't do so.
@@ -149,6 +268,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glActiveTexture(GL_TEXTURE0);
     GLint last_program; glGetIntegerv(GL_CURRENT_PROGRAM, &last_program);
     GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
 #ifdef GL_SAMPLER_BINDING
     GLint last_sampler; glGetIntegerv(GL_SAMPLER_BINDING, &last_sampler);
 #endif
@@ -201,9 +321,13 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         { 0.0f,         0.0f,        -1.0f,   0.0f },
         { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
     };
+    glUseProgram(g_ShaderHandleSDF);
+    glUniform1i(g_AttribLocationTexSDF, 0);
+    glUniformMatrix4fv(g_AttribLocationProjMtxSDF, 1, GL_FALSE, &ortho_projection[0][0]);
     glUseProgram(g_ShaderHandle);
     glUniform1i(g_AttribLocationTex, 0);
     glUniformMatrix4fv(g_AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    GLuint current_program = g_ShaderHandle;
 #ifdef GL_SAMPLER_BINDING
     glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 may set that otherwise.
 #endif
@@ -216,22 +340,28 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     glEnableVertexAttribArray(g_AttribLocationPosition);
     glEnableVertexAttribArray(g_AttribLocationUV);
     glEnableVertexAttribArray(g_AttribLocationColor);
-    glVertexAttribPointer(g_AttribLocationPosition, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, pos));
-    glVertexAttribPointer(g_AttribLocationUV, 2, GL_FLOAT, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, uv));
-    glVertexAttribPointer(g_AttribLocationColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)IM_OFFSETOF(ImDrawVert, col));
+    ImGui_ImplOpenGL3_SetupVertexAttribs();
 
     // Draw
     ImVec2 pos = draw_data->DisplayPos;
+    const bool use_draw_list_buffers = (io.BackendFlags & ImGuiBackendFlags_RendererHasContentHash) != 0;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* cmd_list = draw_data->CmdLists[n];
         const ImDrawIdx* idx_buffer_offset = 0;
 
-        glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
-        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
+        if (use_draw_list_buffers)
+        {
+            ImGui_ImplOpenGL3_BindDrawListBuffers(cmd_list);
+        }
+        else
+        {
+            glBindBuffer(GL_ARRAY_BUFFER, g_VboHandle);
+            glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)cmd_list->VtxBuffer.Size * sizeof(ImDrawVert), (const GLvoid*)cmd_list->VtxBuffer.Data, GL_STREAM_DRAW);
 
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
-        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, g_ElementsHandle);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)cmd_list->IdxBuffer.Size * sizeof(ImDrawIdx), (const GLvoid*)cmd_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        }
 
         for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
         {
@@ -252,8 +382,17 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                     else
                         glScissor((int)clip_rect.x, (int)clip_rect.y, (int)clip_rect.z, (int)clip_rect.w); // Support for GL 4.5's glClipControl(GL_UPPER_LEFT)
 
-                    // Bind texture, Draw
-                    glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->TextureId);
+                    // Bind texture and shader (io.Fonts->TexIDSDF is the font texture sampled as a distance field), Draw
+                    const bool is_sdf = (pcmd->TextureId == (ImTextureID)&g_FontTexture);
+                    const GLuint program = is_sdf ? g_ShaderHandleSDF : g_ShaderHandle;
+                    if (current_program != program)
+                        glUseProgram(current_program = program);
+                    glBindTexture(GL_TEXTURE_2D, is_sdf ? g_FontTexture : (GLuint)(intptr_t)pcmd->TextureId);
+#ifdef IMGUI_IMPL_OPENGL_HAS_DRAW_WITH_BASE_VERTEX
+                    if (g_GlVersion >= 320)
+                        glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset, (GLint)pcmd->VtxOffset);
+                    else
+#endif
                     glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
                 }
             }
@@ -261,6 +400,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
         }
     }
     glDeleteVertexArrays(1, &vao_handle);
+    ImGui_ImplOpenGL3_GarbageCollectDrawListBuffers(false);
 
     // Restore modified GL state
     glUseProgram(last_program);
@@ -301,9 +441,11 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
     glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    io.Fonts->TexDirtyRects.clear();
 
-    // Store our identifier
+    // Store our identifiers. TexIDSDF is the address of our handle, which can't be mistaken for an OpenGL texture name.
     io.Fonts->TexID = (ImTextureID)(intptr_t)g_FontTexture;
+    io.Fonts->TexIDSDF = (ImTextureID)&g_FontTexture;
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -317,7 +459,7 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     {
         ImGuiIO& io = ImGui::GetIO();
         glDeleteTextures(1, &g_FontTexture);
-        io.Fonts->TexID = 0;
+        io.Fonts->TexID = io.Fonts->TexIDSDF = 0;
         g_FontTexture = 0;
     }
 }
@@ -470,28 +612,86 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
         "    Out_Color = Frag_Color * texture(Texture, Frag_UV.st);\n"
         "}\n";
 
+    // Distance field fonts: the glyph outline is at alpha 0.5, antialias over the distance covered by one screen pixel
+    const GLchar* fragment_shader_sdf_glsl_120 =
+        "#ifdef GL_ES\n"
+        "    #extension GL_OES_standard_derivatives : enable\n"
+        "    precision mediump float;\n"
+        "#endif\n"
+        "uniform sampler2D Texture;\n"
+        "varying vec2 Frag_UV;\n"
+        "varying vec4 Frag_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 tex = texture2D(Texture, Frag_UV.st);\n"
+        "    float width = fwidth(tex.a) * 0.5;\n"
+        "    gl_FragColor = Frag_Color * vec4(tex.rgb, smoothstep(0.5 - width, 0.5 + width, tex.a));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_130 =
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    float width = fwidth(tex.a) * 0.5;\n"
+        "    Out_Color = Frag_Color * vec4(tex.rgb, smoothstep(0.5 - width, 0.5 + width, tex.a));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_300_es =
+        "precision mediump float;\n"
+        "uniform sampler2D Texture;\n"
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    float width = fwidth(tex.a) * 0.5;\n"
+        "    Out_Color = Frag_Color * vec4(tex.rgb, smoothstep(0.5 - width, 0.5 + width, tex.a));\n"
+        "}\n";
+
+    const GLchar* fragment_shader_sdf_glsl_410_core =
+        "in vec2 Frag_UV;\n"
+        "in vec4 Frag_Color;\n"
+        "uniform sampler2D Texture;\n"
+        "layout (location = 0) out vec4 Out_Color;\n"
+        "void main()\n"
+        "{\n"
+        "    vec4 tex = texture(Texture, Frag_UV.st);\n"
+        "    float width = fwidth(tex.a) * 0.5;\n"
+        "    Out_Color = Frag_Color * vec4(tex.rgb, smoothstep(0.5 - width, 0.5 + width, tex.a));\n"
+        "}\n";
+
     // Select shaders matching our GLSL versions
     const GLchar* vertex_shader = NULL;
     const GLchar* fragment_shader = NULL;
+    const GLchar* fragment_shader_sdf = NULL;
     if (glsl_version < 130)
     {
         vertex_shader = vertex_shader_glsl_120;
         fragment_shader = fragment_shader_glsl_120;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_120;
     }
     else if (glsl_version >= 410)
     {
         vertex_shader = vertex_shader_glsl_410_core;
         fragment_shader = fragment_shader_glsl_410_core;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_410_core;
     }
     else if (glsl_version == 300)
     {
         vertex_shader = vertex_shader_glsl_300_es;
         fragment_shader = fragment_shader_glsl_300_es;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_300_es;
     }
     else
     {
         vertex_shader = vertex_shader_glsl_130;
         fragment_shader = fragment_shader_glsl_130;
+        fragment_shader_sdf = fragment_shader_sdf_glsl_130;
     }
 
     // Create shaders
@@ -519,6 +719,25 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     g_AttribLocationUV = glGetAttribLocation(g_ShaderHandle, "UV");
     g_AttribLocationColor = glGetAttribLocation(g_ShaderHandle, "Color");
 
+    // Distance field program, sharing the vertex shader and attribute locations (the vertex array is setup once for both programs)
+    const GLchar* fragment_shader_sdf_with_version[2] = { g_GlslVersionString, fragment_shader_sdf };
+    g_FragHandleSDF = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(g_FragHandleSDF, 2, fragment_shader_sdf_with_version, NULL);
+    glCompileShader(g_FragHandleSDF);
+    CheckShader(g_FragHandleSDF, "fragment shader (sdf)");
+
+    g_ShaderHandleSDF = glCreateProgram();
+    glAttachShader(g_ShaderHandleSDF, g_VertHandle);
+    glAttachShader(g_ShaderHandleSDF, g_FragHandleSDF);
+    glBindAttribLocation(g_ShaderHandleSDF, (GLuint)g_AttribLocationPosition, "Position");
+    glBindAttribLocation(g_ShaderHandleSDF, (GLuint)g_AttribLocationUV, "UV");
+    glBindAttribLocation(g_ShaderHandleSDF, (GLuint)g_AttribLocationColor, "Color");
+    glLinkProgram(g_ShaderHandleSDF);
+    CheckProgram(g_ShaderHandleSDF, "shader program (sdf)");
+
+    g_AttribLocationTexSDF = glGetUniformLocation(g_ShaderHandleSDF, "Texture");
+    g_AttribLocationProjMtxSDF = glGetUniformLocation(g_ShaderHandleSDF, "ProjMtx");
+
     // Create buffers
     glGenBuffers(1, &g_VboHandle);
     glGenBuffers(1, &g_ElementsHandle);
@@ -538,6 +757,15 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (g_VboHandle) glDeleteBuffers(1, &g_VboHandle);
     if (g_ElementsHandle) glDeleteBuffers(1, &g_ElementsHandle);
     g_VboHandle = g_ElementsHandle = 0;
+    ImGui_ImplOpenGL3_GarbageCollectDrawListBuffers(true);
+    g_DrawListBuffers.clear();
+
+    if (g_ShaderHandleSDF && g_VertHandle) glDetachShader(g_ShaderHandleSDF, g_VertHandle);
+    if (g_ShaderHandleSDF && g_FragHandleSDF) glDetachShader(g_ShaderHandleSDF, g_FragHandleSDF);
+    if (g_FragHandleSDF) glDeleteShader(g_FragHandleSDF);
+    g_FragHandleSDF = 0;
+    if (g_ShaderHandleSDF) glDeleteProgram(g_ShaderHandleSDF);
+    g_ShaderHandleSDF = 0;
 
     if (g_ShaderHandle && g_VertHandle) glDetachShader(g_ShaderHandle, g_VertHandle);
     if (g_VertHandle) glDeleteShader(g_VertHandle);
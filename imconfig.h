@@ -42,6 +42,20 @@
 //---- Pack colors to BGRA8 instead of RGBA8 (to avoid converting from one to another)
 //#define IMGUI_USE_BGRA_PACKED_COLOR
 
+//---- Use 32-bit for ImWchar (default is 16-bit) to support full Unicode code points up to U+10FFFF (e.g. emojis). Glyph ranges, input characters and InputText() buffers use twice the memory.
+//#define IMGUI_USE_WCHAR32
+
+//---- Use a faster implementation of ImHashData()/ImHashStr() for ID generation, instead of the default byte-at-a-time CRC32.
+// IMGUI_USE_CRC32_SLICE_BY_8 produces the same IDs as the default one, using 7KB of extra lookup tables.
+// IMGUI_USE_CRC32C_SSE42 uses the SSE4.2 crc32 instruction (requires e.g. -msse4.2). It produces different IDs, which only matters if you stored some.
+// Both only pay off on labels with 8+ bytes to hash (e.g. after "###") and on large buffers: on short labels like "Button", the common GetID() case,
+// slice-by-8 is slightly slower than the default (~12.4 ns vs ~10.6 ns). Measure with the hash_* workloads of examples/example_null.
+//#define IMGUI_USE_CRC32_SLICE_BY_8
+//#define IMGUI_USE_CRC32C_SSE42
+
+//---- Rasterize glyphs in ImFontAtlas::Build() on all hardware threads using std::thread (requires C++11), unless you set ImFontAtlas::BuildParallelForFunc to your own job system.
+//#define IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS
+
 //---- Avoid multiple STB libraries implementations, or redefine path/filenames to prioritize another version
 // By default the embedded implementations are declared static and not available outside of imgui cpp files.
 //#define IMGUI_STB_TRUETYPE_FILENAME   "my_folder/stb_truetype.h"
@@ -305,7 +305,8 @@ CODE
 
                  // Render 'pcmd->ElemCount/3' indexed triangles.
                  // By default the indices ImDrawIdx are 16-bits, you can change them to 32-bits in imconfig.h if your engine doesn't support 16-bits indices.
-                 MyEngineDrawIndexedTriangles(pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer, vtx_buffer);
+                 // If you set io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset, indices are relative to vtx_buffer + pcmd->VtxOffset (which allows 64K+ vertices with 16-bits indices).
+                 MyEngineDrawIndexedTriangles(pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer, vtx_buffer + pcmd->VtxOffset);
              }
              idx_buffer += pcmd->ElemCount;
           }
@@ -936,6 +937,9 @@ CODE
 #else
 #include <stdint.h>     // intptr_t
 #endif
+#if defined(_MSC_VER)
+#include <intrin.h>     // _InterlockedExchangeAdd
+#endif
 
 // Debug options
 #define IMGUI_DEBUG_NAV_SCORING     0   // Display navigation scoring preview when hovering items. Display last moving direction matches when holding CTRL
@@ -994,9 +998,11 @@ static void             SetWindowPos(ImGuiWindow* window, const ImVec2& pos, ImG
 static void             SetWindowSize(ImGuiWindow* window, const ImVec2& size, ImGuiCond cond);
 static void             SetWindowCollapsed(ImGuiWindow* window, bool collapsed, ImGuiCond cond);
 static void             FindHoveredWindow();
+static void             UpdateWindowsHitGrid();
 static ImGuiWindow*     CreateNewWindow(const char* name, ImVec2 size, ImGuiWindowFlags flags);
 static void             CheckStacksSize(ImGuiWindow* window, bool write);
 static ImVec2           CalcNextScrollFromScrollTargetAndClamp(ImGuiWindow* window, bool snap_on_edges);
+static ImVec2           CalcTextSizeFinalize(const ImFont* font, float font_size, ImVec2 text_size);
 
 static void             AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* draw_list);
 static void             AddWindowToSortBuffer(ImVector<ImGuiWindow*>* out_sorted_windows, ImGuiWindow* window);
@@ -1179,6 +1185,10 @@ ImGuiIO::ImGuiIO()
     ConfigInputTextCursorBlink = true;
     ConfigWindowsResizeFromEdges = true;
     ConfigWindowsMoveFromTitleBarOnly = false;
+    ConfigStorageUseHashMap = false;
+    ConfigTextGlyphRunCache = false;
+    ConfigTextWrapLayoutCache = false;
+    ConfigWindowsOcclusionCulling = false;
 
     // Platform Functions
     BackendPlatformName = BackendRendererName = NULL;
@@ -1188,6 +1198,8 @@ ImGuiIO::ImGuiIO()
     ClipboardUserData = NULL;
     ImeSetInputScreenPosFn = ImeSetInputScreenPosFn_DefaultImpl;
     ImeWindowHandle = NULL;
+    DrawListJobsDispatchFn = NULL;
+    DrawListJobsUserData = NULL;
 
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     RenderDrawListsFn = NULL;
@@ -1216,7 +1228,7 @@ void ImGuiIO::AddInputCharactersUTF8(const char* utf8_chars)
     {
         unsigned int c = 0;
         utf8_chars += ImTextCharFromUtf8(&c, utf8_chars, NULL);
-        if (c > 0 && c <= 0xFFFF)
+        if (c > 0 && c <= IM_UNICODE_CODEPOINT_MAX)
             InputQueueCharacters.push_back((ImWchar)c);
     }
 }
@@ -1461,25 +1473,260 @@ static const ImU32 GCrc32LookupTable[256] =
     0xBDBDF21C,0xCABAC28A,0x53B39330,0x24B4A3A6,0xBAD03605,0xCDD70693,0x54DE5729,0x23D967BF,0xB3667A2E,0xC4614AB8,0x5D681B02,0x2A6F2B94,0xB40BBE37,0xC30C8EA1,0x5A05DF1B,0x2D02EF8D,
 };
 
+#if defined(IMGUI_USE_CRC32_SLICE_BY_8)
+// Extra tables for slice-by-8 CRC32: GCrc32LookupTableSliceBy8[k][n] is the CRC32 contribution of byte n followed by k+1 zero bytes.
+// Output is identical to the byte-at-a-time version. We trade 7KB of extra tables for processing 8 bytes per iteration.
+static const ImU32 GCrc32LookupTableSliceBy8[7][256] =
+{
+    {
+        0x00000000,0x191B3141,0x32366282,0x2B2D53C3,0x646CC504,0x7D77F445,0x565AA786,0x4F4196C7,0xC8D98A08,0xD1C2BB49,0xFAEFE88A,0xE3F4D9CB,0xACB54F0C,0xB5AE7E4D,0x9E832D8E,0x87981CCF,
+        0x4AC21251,0x53D92310,0x78F470D3,0x61EF4192,0x2EAED755,0x37B5E614,0x1C98B5D7,0x05838496,0x821B9859,0x9B00A918,0xB02DFADB,0xA936CB9A,0xE6775D5D,0xFF6C6C1C,0xD4413FDF,0xCD5A0E9E,
+        0x958424A2,0x8C9F15E3,0xA7B24620,0xBEA97761,0xF1E8E1A6,0xE8F3D0E7,0xC3DE8324,0xDAC5B265,0x5D5DAEAA,0x44469FEB,0x6F6BCC28,0x7670FD69,0x39316BAE,0x202A5AEF,0x0B07092C,0x121C386D,
+        0xDF4636F3,0xC65D07B2,0xED705471,0xF46B6530,0xBB2AF3F7,0xA231C2B6,0x891C9175,0x9007A034,0x179FBCFB,0x0E848DBA,0x25A9DE79,0x3CB2EF38,0x73F379FF,0x6AE848BE,0x41C51B7D,0x58DE2A3C,
+        0xF0794F05,0xE9627E44,0xC24F2D87,0xDB541CC6,0x94158A01,0x8D0EBB40,0xA623E883,0xBF38D9C2,0x38A0C50D,0x21BBF44C,0x0A96A78F,0x138D96CE,0x5CCC0009,0x45D73148,0x6EFA628B,0x77E153CA,
+        0xBABB5D54,0xA3A06C15,0x888D3FD6,0x91960E97,0xDED79850,0xC7CCA911,0xECE1FAD2,0xF5FACB93,0x7262D75C,0x6B79E61D,0x4054B5DE,0x594F849F,0x160E1258,0x0F152319,0x243870DA,0x3D23419B,
+        0x65FD6BA7,0x7CE65AE6,0x57CB0925,0x4ED03864,0x0191AEA3,0x188A9FE2,0x33A7CC21,0x2ABCFD60,0xAD24E1AF,0xB43FD0EE,0x9F12832D,0x8609B26C,0xC94824AB,0xD05315EA,0xFB7E4629,0xE2657768,
+        0x2F3F79F6,0x362448B7,0x1D091B74,0x04122A35,0x4B53BCF2,0x52488DB3,0x7965DE70,0x607EEF31,0xE7E6F3FE,0xFEFDC2BF,0xD5D0917C,0xCCCBA03D,0x838A36FA,0x9A9107BB,0xB1BC5478,0xA8A76539,
+        0x3B83984B,0x2298A90A,0x09B5FAC9,0x10AECB88,0x5FEF5D4F,0x46F46C0E,0x6DD93FCD,0x74C20E8C,0xF35A1243,0xEA412302,0xC16C70C1,0xD8774180,0x9736D747,0x8E2DE606,0xA500B5C5,0xBC1B8484,
+        0x71418A1A,0x685ABB5B,0x4377E898,0x5A6CD9D9,0x152D4F1E,0x0C367E5F,0x271B2D9C,0x3E001CDD,0xB9980012,0xA0833153,0x8BAE6290,0x92B553D1,0xDDF4C516,0xC4EFF457,0xEFC2A794,0xF6D996D5,
+        0xAE07BCE9,0xB71C8DA8,0x9C31DE6B,0x852AEF2A,0xCA6B79ED,0xD37048AC,0xF85D1B6F,0xE1462A2E,0x66DE36E1,0x7FC507A0,0x54E85463,0x4DF36522,0x02B2F3E5,0x1BA9C2A4,0x30849167,0x299FA026,
+        0xE4C5AEB8,0xFDDE9FF9,0xD6F3CC3A,0xCFE8FD7B,0x80A96BBC,0x99B25AFD,0xB29F093E,0xAB84387F,0x2C1C24B0,0x350715F1,0x1E2A4632,0x07317773,0x4870E1B4,0x516BD0F5,0x7A468336,0x635DB277,
+        0xCBFAD74E,0xD2E1E60F,0xF9CCB5CC,0xE0D7848D,0xAF96124A,0xB68D230B,0x9DA070C8,0x84BB4189,0x03235D46,0x1A386C07,0x31153FC4,0x280E0E85,0x674F9842,0x7E54A903,0x5579FAC0,0x4C62CB81,
+        0x8138C51F,0x9823F45E,0xB30EA79D,0xAA1596DC,0xE554001B,0xFC4F315A,0xD7626299,0xCE7953D8,0x49E14F17,0x50FA7E56,0x7BD72D95,0x62CC1CD4,0x2D8D8A13,0x3496BB52,0x1FBBE891,0x06A0D9D0,
+        0x5E7EF3EC,0x4765C2AD,0x6C48916E,0x7553A02F,0x3A1236E8,0x230907A9,0x0824546A,0x113F652B,0x96A779E4,0x8FBC48A5,0xA4911B66,0xBD8A2A27,0xF2CBBCE0,0xEBD08DA1,0xC0FDDE62,0xD9E6EF23,
+        0x14BCE1BD,0x0DA7D0FC,0x268A833F,0x3F91B27E,0x70D024B9,0x69CB15F8,0x42E6463B,0x5BFD777A,0xDC656BB5,0xC57E5AF4,0xEE530937,0xF7483876,0xB809AEB1,0xA1129FF0,0x8A3FCC33,0x9324FD72,
+    },
+    {
+        0x00000000,0x01C26A37,0x0384D46E,0x0246BE59,0x0709A8DC,0x06CBC2EB,0x048D7CB2,0x054F1685,0x0E1351B8,0x0FD13B8F,0x0D9785D6,0x0C55EFE1,0x091AF964,0x08D89353,0x0A9E2D0A,0x0B5C473D,
+        0x1C26A370,0x1DE4C947,0x1FA2771E,0x1E601D29,0x1B2F0BAC,0x1AED619B,0x18ABDFC2,0x1969B5F5,0x1235F2C8,0x13F798FF,0x11B126A6,0x10734C91,0x153C5A14,0x14FE3023,0x16B88E7A,0x177AE44D,
+        0x384D46E0,0x398F2CD7,0x3BC9928E,0x3A0BF8B9,0x3F44EE3C,0x3E86840B,0x3CC03A52,0x3D025065,0x365E1758,0x379C7D6F,0x35DAC336,0x3418A901,0x3157BF84,0x3095D5B3,0x32D36BEA,0x331101DD,
+        0x246BE590,0x25A98FA7,0x27EF31FE,0x262D5BC9,0x23624D4C,0x22A0277B,0x20E69922,0x2124F315,0x2A78B428,0x2BBADE1F,0x29FC6046,0x283E0A71,0x2D711CF4,0x2CB376C3,0x2EF5C89A,0x2F37A2AD,
+        0x709A8DC0,0x7158E7F7,0x731E59AE,0x72DC3399,0x7793251C,0x76514F2B,0x7417F172,0x75D59B45,0x7E89DC78,0x7F4BB64F,0x7D0D0816,0x7CCF6221,0x798074A4,0x78421E93,0x7A04A0CA,0x7BC6CAFD,
+        0x6CBC2EB0,0x6D7E4487,0x6F38FADE,0x6EFA90E9,0x6BB5866C,0x6A77EC5B,0x68315202,0x69F33835,0x62AF7F08,0x636D153F,0x612BAB66,0x60E9C151,0x65A6D7D4,0x6464BDE3,0x662203BA,0x67E0698D,
+        0x48D7CB20,0x4915A117,0x4B531F4E,0x4A917579,0x4FDE63FC,0x4E1C09CB,0x4C5AB792,0x4D98DDA5,0x46C49A98,0x4706F0AF,0x45404EF6,0x448224C1,0x41CD3244,0x400F5873,0x4249E62A,0x438B8C1D,
+        0x54F16850,0x55330267,0x5775BC3E,0x56B7D609,0x53F8C08C,0x523AAABB,0x507C14E2,0x51BE7ED5,0x5AE239E8,0x5B2053DF,0x5966ED86,0x58A487B1,0x5DEB9134,0x5C29FB03,0x5E6F455A,0x5FAD2F6D,
+        0xE1351B80,0xE0F771B7,0xE2B1CFEE,0xE373A5D9,0xE63CB35C,0xE7FED96B,0xE5B86732,0xE47A0D05,0xEF264A38,0xEEE4200F,0xECA29E56,0xED60F461,0xE82FE2E4,0xE9ED88D3,0xEBAB368A,0xEA695CBD,
+        0xFD13B8F0,0xFCD1D2C7,0xFE976C9E,0xFF5506A9,0xFA1A102C,0xFBD87A1B,0xF99EC442,0xF85CAE75,0xF300E948,0xF2C2837F,0xF0843D26,0xF1465711,0xF4094194,0xF5CB2BA3,0xF78D95FA,0xF64FFFCD,
+        0xD9785D60,0xD8BA3757,0xDAFC890E,0xDB3EE339,0xDE71F5BC,0xDFB39F8B,0xDDF521D2,0xDC374BE5,0xD76B0CD8,0xD6A966EF,0xD4EFD8B6,0xD52DB281,0xD062A404,0xD1A0CE33,0xD3E6706A,0xD2241A5D,
+        0xC55EFE10,0xC49C9427,0xC6DA2A7E,0xC7184049,0xC25756CC,0xC3953CFB,0xC1D382A2,0xC011E895,0xCB4DAFA8,0xCA8FC59F,0xC8C97BC6,0xC90B11F1,0xCC440774,0xCD866D43,0xCFC0D31A,0xCE02B92D,
+        0x91AF9640,0x906DFC77,0x922B422E,0x93E92819,0x96A63E9C,0x976454AB,0x9522EAF2,0x94E080C5,0x9FBCC7F8,0x9E7EADCF,0x9C381396,0x9DFA79A1,0x98B56F24,0x99770513,0x9B31BB4A,0x9AF3D17D,
+        0x8D893530,0x8C4B5F07,0x8E0DE15E,0x8FCF8B69,0x8A809DEC,0x8B42F7DB,0x89044982,0x88C623B5,0x839A6488,0x82580EBF,0x801EB0E6,0x81DCDAD1,0x8493CC54,0x8551A663,0x8717183A,0x86D5720D,
+        0xA9E2D0A0,0xA820BA97,0xAA6604CE,0xABA46EF9,0xAEEB787C,0xAF29124B,0xAD6FAC12,0xACADC625,0xA7F18118,0xA633EB2F,0xA4755576,0xA5B73F41,0xA0F829C4,0xA13A43F3,0xA37CFDAA,0xA2BE979D,
+        0xB5C473D0,0xB40619E7,0xB640A7BE,0xB782CD89,0xB2CDDB0C,0xB30FB13B,0xB1490F62,0xB08B6555,0xBBD72268,0xBA15485F,0xB853F606,0xB9919C31,0xBCDE8AB4,0xBD1CE083,0xBF5A5EDA,0xBE9834ED,
+    },
+    {
+        0x00000000,0xB8BC6765,0xAA09C88B,0x12B5AFEE,0x8F629757,0x37DEF032,0x256B5FDC,0x9DD738B9,0xC5B428EF,0x7D084F8A,0x6FBDE064,0xD7018701,0x4AD6BFB8,0xF26AD8DD,0xE0DF7733,0x58631056,
+        0x5019579F,0xE8A530FA,0xFA109F14,0x42ACF871,0xDF7BC0C8,0x67C7A7AD,0x75720843,0xCDCE6F26,0x95AD7F70,0x2D111815,0x3FA4B7FB,0x8718D09E,0x1ACFE827,0xA2738F42,0xB0C620AC,0x087A47C9,
+        0xA032AF3E,0x188EC85B,0x0A3B67B5,0xB28700D0,0x2F503869,0x97EC5F0C,0x8559F0E2,0x3DE59787,0x658687D1,0xDD3AE0B4,0xCF8F4F5A,0x7733283F,0xEAE41086,0x525877E3,0x40EDD80D,0xF851BF68,
+        0xF02BF8A1,0x48979FC4,0x5A22302A,0xE29E574F,0x7F496FF6,0xC7F50893,0xD540A77D,0x6DFCC018,0x359FD04E,0x8D23B72B,0x9F9618C5,0x272A7FA0,0xBAFD4719,0x0241207C,0x10F48F92,0xA848E8F7,
+        0x9B14583D,0x23A83F58,0x311D90B6,0x89A1F7D3,0x1476CF6A,0xACCAA80F,0xBE7F07E1,0x06C36084,0x5EA070D2,0xE61C17B7,0xF4A9B859,0x4C15DF3C,0xD1C2E785,0x697E80E0,0x7BCB2F0E,0xC377486B,
+        0xCB0D0FA2,0x73B168C7,0x6104C729,0xD9B8A04C,0x446F98F5,0xFCD3FF90,0xEE66507E,0x56DA371B,0x0EB9274D,0xB6054028,0xA4B0EFC6,0x1C0C88A3,0x81DBB01A,0x3967D77F,0x2BD27891,0x936E1FF4,
+        0x3B26F703,0x839A9066,0x912F3F88,0x299358ED,0xB4446054,0x0CF80731,0x1E4DA8DF,0xA6F1CFBA,0xFE92DFEC,0x462EB889,0x549B1767,0xEC277002,0x71F048BB,0xC94C2FDE,0xDBF98030,0x6345E755,
+        0x6B3FA09C,0xD383C7F9,0xC1366817,0x798A0F72,0xE45D37CB,0x5CE150AE,0x4E54FF40,0xF6E89825,0xAE8B8873,0x1637EF16,0x048240F8,0xBC3E279D,0x21E91F24,0x99557841,0x8BE0D7AF,0x335CB0CA,
+        0xED59B63B,0x55E5D15E,0x47507EB0,0xFFEC19D5,0x623B216C,0xDA874609,0xC832E9E7,0x708E8E82,0x28ED9ED4,0x9051F9B1,0x82E4565F,0x3A58313A,0xA78F0983,0x1F336EE6,0x0D86C108,0xB53AA66D,
+        0xBD40E1A4,0x05FC86C1,0x1749292F,0xAFF54E4A,0x322276F3,0x8A9E1196,0x982BBE78,0x2097D91D,0x78F4C94B,0xC048AE2E,0xD2FD01C0,0x6A4166A5,0xF7965E1C,0x4F2A3979,0x5D9F9697,0xE523F1F2,
+        0x4D6B1905,0xF5D77E60,0xE762D18E,0x5FDEB6EB,0xC2098E52,0x7AB5E937,0x680046D9,0xD0BC21BC,0x88DF31EA,0x3063568F,0x22D6F961,0x9A6A9E04,0x07BDA6BD,0xBF01C1D8,0xADB46E36,0x15080953,
+        0x1D724E9A,0xA5CE29FF,0xB77B8611,0x0FC7E174,0x9210D9CD,0x2AACBEA8,0x38191146,0x80A57623,0xD8C66675,0x607A0110,0x72CFAEFE,0xCA73C99B,0x57A4F122,0xEF189647,0xFDAD39A9,0x45115ECC,
+        0x764DEE06,0xCEF18963,0xDC44268D,0x64F841E8,0xF92F7951,0x41931E34,0x5326B1DA,0xEB9AD6BF,0xB3F9C6E9,0x0B45A18C,0x19F00E62,0xA14C6907,0x3C9B51BE,0x842736DB,0x96929935,0x2E2EFE50,
+        0x2654B999,0x9EE8DEFC,0x8C5D7112,0x34E11677,0xA9362ECE,0x118A49AB,0x033FE645,0xBB838120,0xE3E09176,0x5B5CF613,0x49E959FD,0xF1553E98,0x6C820621,0xD43E6144,0xC68BCEAA,0x7E37A9CF,
+        0xD67F4138,0x6EC3265D,0x7C7689B3,0xC4CAEED6,0x591DD66F,0xE1A1B10A,0xF3141EE4,0x4BA87981,0x13CB69D7,0xAB770EB2,0xB9C2A15C,0x017EC639,0x9CA9FE80,0x241599E5,0x36A0360B,0x8E1C516E,
+        0x866616A7,0x3EDA71C2,0x2C6FDE2C,0x94D3B949,0x090481F0,0xB1B8E695,0xA30D497B,0x1BB12E1E,0x43D23E48,0xFB6E592D,0xE9DBF6C3,0x516791A6,0xCCB0A91F,0x740CCE7A,0x66B96194,0xDE0506F1,
+    },
+    {
+        0x00000000,0x3D6029B0,0x7AC05360,0x47A07AD0,0xF580A6C0,0xC8E08F70,0x8F40F5A0,0xB220DC10,0x30704BC1,0x0D106271,0x4AB018A1,0x77D03111,0xC5F0ED01,0xF890C4B1,0xBF30BE61,0x825097D1,
+        0x60E09782,0x5D80BE32,0x1A20C4E2,0x2740ED52,0x95603142,0xA80018F2,0xEFA06222,0xD2C04B92,0x5090DC43,0x6DF0F5F3,0x2A508F23,0x1730A693,0xA5107A83,0x98705333,0xDFD029E3,0xE2B00053,
+        0xC1C12F04,0xFCA106B4,0xBB017C64,0x866155D4,0x344189C4,0x0921A074,0x4E81DAA4,0x73E1F314,0xF1B164C5,0xCCD14D75,0x8B7137A5,0xB6111E15,0x0431C205,0x3951EBB5,0x7EF19165,0x4391B8D5,
+        0xA121B886,0x9C419136,0xDBE1EBE6,0xE681C256,0x54A11E46,0x69C137F6,0x2E614D26,0x13016496,0x9151F347,0xAC31DAF7,0xEB91A027,0xD6F18997,0x64D15587,0x59B17C37,0x1E1106E7,0x23712F57,
+        0x58F35849,0x659371F9,0x22330B29,0x1F532299,0xAD73FE89,0x9013D739,0xD7B3ADE9,0xEAD38459,0x68831388,0x55E33A38,0x124340E8,0x2F236958,0x9D03B548,0xA0639CF8,0xE7C3E628,0xDAA3CF98,
+        0x3813CFCB,0x0573E67B,0x42D39CAB,0x7FB3B51B,0xCD93690B,0xF0F340BB,0xB7533A6B,0x8A3313DB,0x0863840A,0x3503ADBA,0x72A3D76A,0x4FC3FEDA,0xFDE322CA,0xC0830B7A,0x872371AA,0xBA43581A,
+        0x9932774D,0xA4525EFD,0xE3F2242D,0xDE920D9D,0x6CB2D18D,0x51D2F83D,0x167282ED,0x2B12AB5D,0xA9423C8C,0x9422153C,0xD3826FEC,0xEEE2465C,0x5CC29A4C,0x61A2B3FC,0x2602C92C,0x1B62E09C,
+        0xF9D2E0CF,0xC4B2C97F,0x8312B3AF,0xBE729A1F,0x0C52460F,0x31326FBF,0x7692156F,0x4BF23CDF,0xC9A2AB0E,0xF4C282BE,0xB362F86E,0x8E02D1DE,0x3C220DCE,0x0142247E,0x46E25EAE,0x7B82771E,
+        0xB1E6B092,0x8C869922,0xCB26E3F2,0xF646CA42,0x44661652,0x79063FE2,0x3EA64532,0x03C66C82,0x8196FB53,0xBCF6D2E3,0xFB56A833,0xC6368183,0x74165D93,0x49767423,0x0ED60EF3,0x33B62743,
+        0xD1062710,0xEC660EA0,0xABC67470,0x96A65DC0,0x248681D0,0x19E6A860,0x5E46D2B0,0x6326FB00,0xE1766CD1,0xDC164561,0x9BB63FB1,0xA6D61601,0x14F6CA11,0x2996E3A1,0x6E369971,0x5356B0C1,
+        0x70279F96,0x4D47B626,0x0AE7CCF6,0x3787E546,0x85A73956,0xB8C710E6,0xFF676A36,0xC2074386,0x4057D457,0x7D37FDE7,0x3A978737,0x07F7AE87,0xB5D77297,0x88B75B27,0xCF1721F7,0xF2770847,
+        0x10C70814,0x2DA721A4,0x6A075B74,0x576772C4,0xE547AED4,0xD8278764,0x9F87FDB4,0xA2E7D404,0x20B743D5,0x1DD76A65,0x5A7710B5,0x67173905,0xD537E515,0xE857CCA5,0xAFF7B675,0x92979FC5,
+        0xE915E8DB,0xD475C16B,0x93D5BBBB,0xAEB5920B,0x1C954E1B,0x21F567AB,0x66551D7B,0x5B3534CB,0xD965A31A,0xE4058AAA,0xA3A5F07A,0x9EC5D9CA,0x2CE505DA,0x11852C6A,0x562556BA,0x6B457F0A,
+        0x89F57F59,0xB49556E9,0xF3352C39,0xCE550589,0x7C75D999,0x4115F029,0x06B58AF9,0x3BD5A349,0xB9853498,0x84E51D28,0xC34567F8,0xFE254E48,0x4C059258,0x7165BBE8,0x36C5C138,0x0BA5E888,
+        0x28D4C7DF,0x15B4EE6F,0x521494BF,0x6F74BD0F,0xDD54611F,0xE03448AF,0xA794327F,0x9AF41BCF,0x18A48C1E,0x25C4A5AE,0x6264DF7E,0x5F04F6CE,0xED242ADE,0xD044036E,0x97E479BE,0xAA84500E,
+        0x4834505D,0x755479ED,0x32F4033D,0x0F942A8D,0xBDB4F69D,0x80D4DF2D,0xC774A5FD,0xFA148C4D,0x78441B9C,0x4524322C,0x028448FC,0x3FE4614C,0x8DC4BD5C,0xB0A494EC,0xF704EE3C,0xCA64C78C,
+    },
+    {
+        0x00000000,0xCB5CD3A5,0x4DC8A10B,0x869472AE,0x9B914216,0x50CD91B3,0xD659E31D,0x1D0530B8,0xEC53826D,0x270F51C8,0xA19B2366,0x6AC7F0C3,0x77C2C07B,0xBC9E13DE,0x3A0A6170,0xF156B2D5,
+        0x03D6029B,0xC88AD13E,0x4E1EA390,0x85427035,0x9847408D,0x531B9328,0xD58FE186,0x1ED33223,0xEF8580F6,0x24D95353,0xA24D21FD,0x6911F258,0x7414C2E0,0xBF481145,0x39DC63EB,0xF280B04E,
+        0x07AC0536,0xCCF0D693,0x4A64A43D,0x81387798,0x9C3D4720,0x57619485,0xD1F5E62B,0x1AA9358E,0xEBFF875B,0x20A354FE,0xA6372650,0x6D6BF5F5,0x706EC54D,0xBB3216E8,0x3DA66446,0xF6FAB7E3,
+        0x047A07AD,0xCF26D408,0x49B2A6A6,0x82EE7503,0x9FEB45BB,0x54B7961E,0xD223E4B0,0x197F3715,0xE82985C0,0x23755665,0xA5E124CB,0x6EBDF76E,0x73B8C7D6,0xB8E41473,0x3E7066DD,0xF52CB578,
+        0x0F580A6C,0xC404D9C9,0x4290AB67,0x89CC78C2,0x94C9487A,0x5F959BDF,0xD901E971,0x125D3AD4,0xE30B8801,0x28575BA4,0xAEC3290A,0x659FFAAF,0x789ACA17,0xB3C619B2,0x35526B1C,0xFE0EB8B9,
+        0x0C8E08F7,0xC7D2DB52,0x4146A9FC,0x8A1A7A59,0x971F4AE1,0x5C439944,0xDAD7EBEA,0x118B384F,0xE0DD8A9A,0x2B81593F,0xAD152B91,0x6649F834,0x7B4CC88C,0xB0101B29,0x36846987,0xFDD8BA22,
+        0x08F40F5A,0xC3A8DCFF,0x453CAE51,0x8E607DF4,0x93654D4C,0x58399EE9,0xDEADEC47,0x15F13FE2,0xE4A78D37,0x2FFB5E92,0xA96F2C3C,0x6233FF99,0x7F36CF21,0xB46A1C84,0x32FE6E2A,0xF9A2BD8F,
+        0x0B220DC1,0xC07EDE64,0x46EAACCA,0x8DB67F6F,0x90B34FD7,0x5BEF9C72,0xDD7BEEDC,0x16273D79,0xE7718FAC,0x2C2D5C09,0xAAB92EA7,0x61E5FD02,0x7CE0CDBA,0xB7BC1E1F,0x31286CB1,0xFA74BF14,
+        0x1EB014D8,0xD5ECC77D,0x5378B5D3,0x98246676,0x852156CE,0x4E7D856B,0xC8E9F7C5,0x03B52460,0xF2E396B5,0x39BF4510,0xBF2B37BE,0x7477E41B,0x6972D4A3,0xA22E0706,0x24BA75A8,0xEFE6A60D,
+        0x1D661643,0xD63AC5E6,0x50AEB748,0x9BF264ED,0x86F75455,0x4DAB87F0,0xCB3FF55E,0x006326FB,0xF135942E,0x3A69478B,0xBCFD3525,0x77A1E680,0x6AA4D638,0xA1F8059D,0x276C7733,0xEC30A496,
+        0x191C11EE,0xD240C24B,0x54D4B0E5,0x9F886340,0x828D53F8,0x49D1805D,0xCF45F2F3,0x04192156,0xF54F9383,0x3E134026,0xB8873288,0x73DBE12D,0x6EDED195,0xA5820230,0x2316709E,0xE84AA33B,
+        0x1ACA1375,0xD196C0D0,0x5702B27E,0x9C5E61DB,0x815B5163,0x4A0782C6,0xCC93F068,0x07CF23CD,0xF6999118,0x3DC542BD,0xBB513013,0x700DE3B6,0x6D08D30E,0xA65400AB,0x20C07205,0xEB9CA1A0,
+        0x11E81EB4,0xDAB4CD11,0x5C20BFBF,0x977C6C1A,0x8A795CA2,0x41258F07,0xC7B1FDA9,0x0CED2E0C,0xFDBB9CD9,0x36E74F7C,0xB0733DD2,0x7B2FEE77,0x662ADECF,0xAD760D6A,0x2BE27FC4,0xE0BEAC61,
+        0x123E1C2F,0xD962CF8A,0x5FF6BD24,0x94AA6E81,0x89AF5E39,0x42F38D9C,0xC467FF32,0x0F3B2C97,0xFE6D9E42,0x35314DE7,0xB3A53F49,0x78F9ECEC,0x65FCDC54,0xAEA00FF1,0x28347D5F,0xE368AEFA,
+        0x16441B82,0xDD18C827,0x5B8CBA89,0x90D0692C,0x8DD55994,0x46898A31,0xC01DF89F,0x0B412B3A,0xFA1799EF,0x314B4A4A,0xB7DF38E4,0x7C83EB41,0x6186DBF9,0xAADA085C,0x2C4E7AF2,0xE712A957,
+        0x15921919,0xDECECABC,0x585AB812,0x93066BB7,0x8E035B0F,0x455F88AA,0xC3CBFA04,0x089729A1,0xF9C19B74,0x329D48D1,0xB4093A7F,0x7F55E9DA,0x6250D962,0xA90C0AC7,0x2F987869,0xE4C4ABCC,
+    },
+    {
+        0x00000000,0xA6770BB4,0x979F1129,0x31E81A9D,0xF44F2413,0x52382FA7,0x63D0353A,0xC5A73E8E,0x33EF4E67,0x959845D3,0xA4705F4E,0x020754FA,0xC7A06A74,0x61D761C0,0x503F7B5D,0xF64870E9,
+        0x67DE9CCE,0xC1A9977A,0xF0418DE7,0x56368653,0x9391B8DD,0x35E6B369,0x040EA9F4,0xA279A240,0x5431D2A9,0xF246D91D,0xC3AEC380,0x65D9C834,0xA07EF6BA,0x0609FD0E,0x37E1E793,0x9196EC27,
+        0xCFBD399C,0x69CA3228,0x582228B5,0xFE552301,0x3BF21D8F,0x9D85163B,0xAC6D0CA6,0x0A1A0712,0xFC5277FB,0x5A257C4F,0x6BCD66D2,0xCDBA6D66,0x081D53E8,0xAE6A585C,0x9F8242C1,0x39F54975,
+        0xA863A552,0x0E14AEE6,0x3FFCB47B,0x998BBFCF,0x5C2C8141,0xFA5B8AF5,0xCBB39068,0x6DC49BDC,0x9B8CEB35,0x3DFBE081,0x0C13FA1C,0xAA64F1A8,0x6FC3CF26,0xC9B4C492,0xF85CDE0F,0x5E2BD5BB,
+        0x440B7579,0xE27C7ECD,0xD3946450,0x75E36FE4,0xB044516A,0x16335ADE,0x27DB4043,0x81AC4BF7,0x77E43B1E,0xD19330AA,0xE07B2A37,0x460C2183,0x83AB1F0D,0x25DC14B9,0x14340E24,0xB2430590,
+        0x23D5E9B7,0x85A2E203,0xB44AF89E,0x123DF32A,0xD79ACDA4,0x71EDC610,0x4005DC8D,0xE672D739,0x103AA7D0,0xB64DAC64,0x87A5B6F9,0x21D2BD4D,0xE47583C3,0x42028877,0x73EA92EA,0xD59D995E,
+        0x8BB64CE5,0x2DC14751,0x1C295DCC,0xBA5E5678,0x7FF968F6,0xD98E6342,0xE86679DF,0x4E11726B,0xB8590282,0x1E2E0936,0x2FC613AB,0x89B1181F,0x4C162691,0xEA612D25,0xDB8937B8,0x7DFE3C0C,
+        0xEC68D02B,0x4A1FDB9F,0x7BF7C102,0xDD80CAB6,0x1827F438,0xBE50FF8C,0x8FB8E511,0x29CFEEA5,0xDF879E4C,0x79F095F8,0x48188F65,0xEE6F84D1,0x2BC8BA5F,0x8DBFB1EB,0xBC57AB76,0x1A20A0C2,
+        0x8816EAF2,0x2E61E146,0x1F89FBDB,0xB9FEF06F,0x7C59CEE1,0xDA2EC555,0xEBC6DFC8,0x4DB1D47C,0xBBF9A495,0x1D8EAF21,0x2C66B5BC,0x8A11BE08,0x4FB68086,0xE9C18B32,0xD82991AF,0x7E5E9A1B,
+        0xEFC8763C,0x49BF7D88,0x78576715,0xDE206CA1,0x1B87522F,0xBDF0599B,0x8C184306,0x2A6F48B2,0xDC27385B,0x7A5033EF,0x4BB82972,0xEDCF22C6,0x28681C48,0x8E1F17FC,0xBFF70D61,0x198006D5,
+        0x47ABD36E,0xE1DCD8DA,0xD034C247,0x7643C9F3,0xB3E4F77D,0x1593FCC9,0x247BE654,0x820CEDE0,0x74449D09,0xD23396BD,0xE3DB8C20,0x45AC8794,0x800BB91A,0x267CB2AE,0x1794A833,0xB1E3A387,
+        0x20754FA0,0x86024414,0xB7EA5E89,0x119D553D,0xD43A6BB3,0x724D6007,0x43A57A9A,0xE5D2712E,0x139A01C7,0xB5ED0A73,0x840510EE,0x22721B5A,0xE7D525D4,0x41A22E60,0x704A34FD,0xD63D3F49,
+        0xCC1D9F8B,0x6A6A943F,0x5B828EA2,0xFDF58516,0x3852BB98,0x9E25B02C,0xAFCDAAB1,0x09BAA105,0xFFF2D1EC,0x5985DA58,0x686DC0C5,0xCE1ACB71,0x0BBDF5FF,0xADCAFE4B,0x9C22E4D6,0x3A55EF62,
+        0xABC30345,0x0DB408F1,0x3C5C126C,0x9A2B19D8,0x5F8C2756,0xF9FB2CE2,0xC813367F,0x6E643DCB,0x982C4D22,0x3E5B4696,0x0FB35C0B,0xA9C457BF,0x6C636931,0xCA146285,0xFBFC7818,0x5D8B73AC,
+        0x03A0A617,0xA5D7ADA3,0x943FB73E,0x3248BC8A,0xF7EF8204,0x519889B0,0x6070932D,0xC6079899,0x304FE870,0x9638E3C4,0xA7D0F959,0x01A7F2ED,0xC400CC63,0x6277C7D7,0x539FDD4A,0xF5E8D6FE,
+        0x647E3AD9,0xC209316D,0xF3E12BF0,0x55962044,0x90311ECA,0x3646157E,0x07AE0FE3,0xA1D90457,0x579174BE,0xF1E67F0A,0xC00E6597,0x66796E23,0xA3DE50AD,0x05A95B19,0x34414184,0x92364A30,
+    },
+    {
+        0x00000000,0xCCAA009E,0x4225077D,0x8E8F07E3,0x844A0EFA,0x48E00E64,0xC66F0987,0x0AC50919,0xD3E51BB5,0x1F4F1B2B,0x91C01CC8,0x5D6A1C56,0x57AF154F,0x9B0515D1,0x158A1232,0xD92012AC,
+        0x7CBB312B,0xB01131B5,0x3E9E3656,0xF23436C8,0xF8F13FD1,0x345B3F4F,0xBAD438AC,0x767E3832,0xAF5E2A9E,0x63F42A00,0xED7B2DE3,0x21D12D7D,0x2B142464,0xE7BE24FA,0x69312319,0xA59B2387,
+        0xF9766256,0x35DC62C8,0xBB53652B,0x77F965B5,0x7D3C6CAC,0xB1966C32,0x3F196BD1,0xF3B36B4F,0x2A9379E3,0xE639797D,0x68B67E9E,0xA41C7E00,0xAED97719,0x62737787,0xECFC7064,0x205670FA,
+        0x85CD537D,0x496753E3,0xC7E85400,0x0B42549E,0x01875D87,0xCD2D5D19,0x43A25AFA,0x8F085A64,0x562848C8,0x9A824856,0x140D4FB5,0xD8A74F2B,0xD2624632,0x1EC846AC,0x9047414F,0x5CED41D1,
+        0x299DC2ED,0xE537C273,0x6BB8C590,0xA712C50E,0xADD7CC17,0x617DCC89,0xEFF2CB6A,0x2358CBF4,0xFA78D958,0x36D2D9C6,0xB85DDE25,0x74F7DEBB,0x7E32D7A2,0xB298D73C,0x3C17D0DF,0xF0BDD041,
+        0x5526F3C6,0x998CF358,0x1703F4BB,0xDBA9F425,0xD16CFD3C,0x1DC6FDA2,0x9349FA41,0x5FE3FADF,0x86C3E873,0x4A69E8ED,0xC4E6EF0E,0x084CEF90,0x0289E689,0xCE23E617,0x40ACE1F4,0x8C06E16A,
+        0xD0EBA0BB,0x1C41A025,0x92CEA7C6,0x5E64A758,0x54A1AE41,0x980BAEDF,0x1684A93C,0xDA2EA9A2,0x030EBB0E,0xCFA4BB90,0x412BBC73,0x8D81BCED,0x8744B5F4,0x4BEEB56A,0xC561B289,0x09CBB217,
+        0xAC509190,0x60FA910E,0xEE7596ED,0x22DF9673,0x281A9F6A,0xE4B09FF4,0x6A3F9817,0xA6959889,0x7FB58A25,0xB31F8ABB,0x3D908D58,0xF13A8DC6,0xFBFF84DF,0x37558441,0xB9DA83A2,0x7570833C,
+        0x533B85DA,0x9F918544,0x111E82A7,0xDDB48239,0xD7718B20,0x1BDB8BBE,0x95548C5D,0x59FE8CC3,0x80DE9E6F,0x4C749EF1,0xC2FB9912,0x0E51998C,0x04949095,0xC83E900B,0x46B197E8,0x8A1B9776,
+        0x2F80B4F1,0xE32AB46F,0x6DA5B38C,0xA10FB312,0xABCABA0B,0x6760BA95,0xE9EFBD76,0x2545BDE8,0xFC65AF44,0x30CFAFDA,0xBE40A839,0x72EAA8A7,0x782FA1BE,0xB485A120,0x3A0AA6C3,0xF6A0A65D,
+        0xAA4DE78C,0x66E7E712,0xE868E0F1,0x24C2E06F,0x2E07E976,0xE2ADE9E8,0x6C22EE0B,0xA088EE95,0x79A8FC39,0xB502FCA7,0x3B8DFB44,0xF727FBDA,0xFDE2F2C3,0x3148F25D,0xBFC7F5BE,0x736DF520,
+        0xD6F6D6A7,0x1A5CD639,0x94D3D1DA,0x5879D144,0x52BCD85D,0x9E16D8C3,0x1099DF20,0xDC33DFBE,0x0513CD12,0xC9B9CD8C,0x4736CA6F,0x8B9CCAF1,0x8159C3E8,0x4DF3C376,0xC37CC495,0x0FD6C40B,
+        0x7AA64737,0xB60C47A9,0x3883404A,0xF42940D4,0xFEEC49CD,0x32464953,0xBCC94EB0,0x70634E2E,0xA9435C82,0x65E95C1C,0xEB665BFF,0x27CC5B61,0x2D095278,0xE1A352E6,0x6F2C5505,0xA386559B,
+        0x061D761C,0xCAB77682,0x44387161,0x889271FF,0x825778E6,0x4EFD7878,0xC0727F9B,0x0CD87F05,0xD5F86DA9,0x19526D37,0x97DD6AD4,0x5B776A4A,0x51B26353,0x9D1863CD,0x1397642E,0xDF3D64B0,
+        0x83D02561,0x4F7A25FF,0xC1F5221C,0x0D5F2282,0x079A2B9B,0xCB302B05,0x45BF2CE6,0x89152C78,0x50353ED4,0x9C9F3E4A,0x121039A9,0xDEBA3937,0xD47F302E,0x18D530B0,0x965A3753,0x5AF037CD,
+        0xFF6B144A,0x33C114D4,0xBD4E1337,0x71E413A9,0x7B211AB0,0xB78B1A2E,0x39041DCD,0xF5AE1D53,0x2C8E0FFF,0xE0240F61,0x6EAB0882,0xA201081C,0xA8C40105,0x646E019B,0xEAE10678,0x264B06E6,
+    },
+};
+#elif defined(IMGUI_USE_CRC32C_SSE42)
+// Hardware CRC32C (Castagnoli polynomial) using the SSE4.2 crc32 instruction. Output differs from the default CRC32.
+#if !defined(__SSE4_2__) && !defined(_MSC_VER)
+#error "IMGUI_USE_CRC32C_SSE42 requires SSE4.2 to be enabled at compile time (e.g. -msse4.2)"
+#endif
+#include <nmmintrin.h>      // _mm_crc32_u8, _mm_crc32_u32, _mm_crc32_u64
+#endif
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
-// FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+// Define IMGUI_USE_CRC32_SLICE_BY_8 or IMGUI_USE_CRC32C_SSE42 in imconfig.h to use a faster implementation.
 ImU32 ImHashData(const void* data_p, size_t data_size, ImU32 seed)
 {
     ImU32 crc = ~seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#if defined(IMGUI_USE_CRC32C_SSE42)
+#if defined(_M_X64) || defined(__x86_64__)
+    ImU64 crc64 = crc;
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, sizeof(v));
+        crc64 = _mm_crc32_u64(crc64, v);
+    }
+    crc = (ImU32)crc64;
+#endif
+    for (; data_size >= 4; data_size -= 4, data += 4)
+    {
+        ImU32 v;
+        memcpy(&v, data, sizeof(v));
+        crc = _mm_crc32_u32(crc, v);
+    }
+    while (data_size-- != 0)
+        crc = _mm_crc32_u8(crc, *data++);
+#else
     const ImU32* crc32_lut = GCrc32LookupTable;
+#if defined(IMGUI_USE_CRC32_SLICE_BY_8)
+    const ImU32 (*crc32_lut_n)[256] = GCrc32LookupTableSliceBy8;
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        const ImU32 lo = crc ^ ((ImU32)data[0] | ((ImU32)data[1] << 8) | ((ImU32)data[2] << 16) | ((ImU32)data[3] << 24));
+        crc = crc32_lut_n[6][lo & 0xFF] ^ crc32_lut_n[5][(lo >> 8) & 0xFF] ^ crc32_lut_n[4][(lo >> 16) & 0xFF] ^ crc32_lut_n[3][lo >> 24]
+            ^ crc32_lut_n[2][data[4]] ^ crc32_lut_n[1][data[5]] ^ crc32_lut_n[0][data[6]] ^ crc32_lut[data[7]];
+    }
+#endif
     while (data_size-- != 0)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
+#endif
     return ~crc;
 }
 
+// Known size hash of bulk data (e.g. draw list contents), not used for IDs.
+// Each 8 bytes word is xored with a position key and multiplied by an odd constant (a bijection, so changing a single word always changes
+// the hash), then added to one of 4 accumulators: as multiplies don't depend on previous results, the 4 lanes
+// can be pipelined. This still costs about twice a memcpy() of the same data.
+static inline ImU64 ImHashMix64(ImU64 h, ImU64 v)
+{
+    h = (h ^ v) * (ImU64)0xFF51AFD7ED558CCDULL;
+    return h ^ (h >> 32);
+}
+
+ImU64 ImHashData64(const void* data_p, size_t data_size, ImU64 seed)
+{
+    const ImU64 K_MUL = (ImU64)0x9E3779B97F4A7C15ULL;
+    const ImU64 K_POS = (ImU64)0xC2B2AE3D27D4EB4FULL;
+    const unsigned char* data = (const unsigned char*)data_p;
+    ImU64 acc0 = seed ^ (ImU64)data_size, acc1 = 0, acc2 = 0, acc3 = 0;
+    ImU64 pos_key = K_POS;
+    for (; data_size >= 32; data_size -= 32, data += 32, pos_key += K_POS)
+    {
+        ImU64 v[4];
+        memcpy(v, data, sizeof(v));
+        acc0 += (v[0] ^ pos_key) * K_MUL;
+        acc1 += (v[1] ^ (pos_key + 1)) * K_MUL;
+        acc2 += (v[2] ^ (pos_key + 2)) * K_MUL;
+        acc3 += (v[3] ^ (pos_key + 3)) * K_MUL;
+    }
+    for (; data_size >= 8; data_size -= 8, data += 8, pos_key += K_POS)
+    {
+        ImU64 v;
+        memcpy(&v, data, sizeof(v));
+        acc1 += (v ^ pos_key) * K_MUL;
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, data_size);
+        acc2 += (v ^ pos_key) * K_MUL;
+    }
+    return ImHashMix64(ImHashMix64(ImHashMix64(ImHashMix64(acc0, acc1), acc2), acc3), seed);
+}
+
 // Zero-terminated string hash, with support for ### to reset back to seed value
 // We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
 // Because this syntax is rarely used we are optimizing for the common case.
 // - If we reach ### in the string we discard the hash so far and reset to the seed.
 // - We don't do 'current += 2; continue;' after handling ### to keep the code smaller/faster (measured ~10% diff in Debug build)
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
+#if defined(IMGUI_USE_CRC32_SLICE_BY_8) || defined(IMGUI_USE_CRC32C_SSE42)
+// With a faster ImHashData() it is cheaper to locate the last ### first (a cheap scan without dependency on the hash value), then
+// hash the remaining data in bulk. This gives the same result as resetting the hash to the seed value every time we meet ###.
+ImU32 ImHashStr(const char* data, size_t data_size, ImU32 seed)
+{
+    const char* hash_begin = data;
+    const char* p = data;
+    if (data_size != 0)
+    {
+        const char* data_end = data + data_size;
+        for (; p + 2 < data_end; p++)
+            if (p[0] == '#' && p[1] == '#' && p[2] == '#')
+                hash_begin = p;
+        p = data_end;
+    }
+    else
+    {
+        for (; *p; p++)
+            if (p[0] == '#' && p[1] == '#' && p[2] == '#')
+                hash_begin = p;
+    }
+    return ImHashData(hash_begin, (size_t)(p - hash_begin), seed);
+}
+#else
 ImU32 ImHashStr(const char* data, size_t data_size, ImU32 seed)
 {
     seed = ~seed;
@@ -1507,6 +1754,7 @@ ImU32 ImHashStr(const char* data, size_t data_size, ImU32 seed)
     }
     return ~crc;
 }
+#endif
 
 FILE* ImFileOpen(const char* filename, const char* mode)
 {
@@ -1641,7 +1889,7 @@ int ImTextStrFromUtf8(ImWchar* buf, int buf_size, const char* in_text, const cha
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
             break;
-        if (c < 0x10000)    // FIXME: Losing characters that don't fit in 2 bytes
+        if (c <= IM_UNICODE_CODEPOINT_MAX)    // FIXME: Losing characters that don't fit in 2 bytes, unless IMGUI_USE_WCHAR32 is defined
             *buf_out++ = (ImWchar)c;
     }
     *buf_out = 0;
@@ -1659,7 +1907,7 @@ int ImTextCountCharsFromUtf8(const char* in_text, const char* in_text_end)
         in_text += ImTextCharFromUtf8(&c, in_text, in_text_end);
         if (c == 0)
             break;
-        if (c < 0x10000)
+        if (c <= IM_UNICODE_CODEPOINT_MAX)
             char_count++;
     }
     return char_count;
@@ -1693,7 +1941,7 @@ static inline int ImTextCharToUtf8(char* buf, int buf_size, unsigned int c)
         buf[3] = (char)(0x80 + ((c ) & 0x3f));
         return 4;
     }
-    //else if (c < 0x10000)
+    if (c < 0x10000)
     {
         if (buf_size < 3) return 0;
         buf[0] = (char)(0xe0 + (c >> 12));
@@ -1701,6 +1949,16 @@ static inline int ImTextCharToUtf8(char* buf, int buf_size, unsigned int c)
         buf[2] = (char)(0x80 + ((c ) & 0x3f));
         return 3;
     }
+    if (c <= 0x10FFFF)
+    {
+        if (buf_size < 4) return 0;
+        buf[0] = (char)(0xf0 + (c >> 18));
+        buf[1] = (char)(0x80 + ((c >> 12) & 0x3f));
+        buf[2] = (char)(0x80 + ((c >> 6) & 0x3f));
+        buf[3] = (char)(0x80 + ((c ) & 0x3f));
+        return 4;
+    }
+    return 0;
 }
 
 // Not optimal but we very rarely use this function.
@@ -1716,7 +1974,9 @@ static inline int ImTextCountUtf8BytesFromChar(unsigned int c)
     if (c < 0x800) return 2;
     if (c >= 0xdc00 && c < 0xe000) return 0;
     if (c >= 0xd800 && c < 0xdc00) return 4;
-    return 3;
+    if (c < 0x10000) return 3;
+    if (c <= 0x10FFFF) return 4;
+    return 0;
 }
 
 int ImTextStrToUtf8(char* buf, int buf_size, const ImWchar* in_text, const ImWchar* in_text_end)
@@ -1885,6 +2145,77 @@ static ImGuiStorage::Pair* LowerBound(ImVector<ImGuiStorage::Pair>& data, ImGuiI
     return first;
 }
 
+// Optional open-addressing hash index (linear probing, load factor <= 1/2), enabled by io.ConfigStorageUseHashMap.
+// HashIndex[] stores indices into Data[] or -1 for empty slots. When it is in use, Data[] is kept in insertion order and
+// both queries and insertions are O(1) instead of O(log N) queries and O(N) insertions for the sorted Data[] array.
+// There is no removal API besides Clear(), so we never need tombstones.
+static inline ImU32 StorageHashKey(ImGuiID key)
+{
+    // ID are already hashes but the low bits of user-provided keys (e.g. small integers or pointers) may be poorly distributed.
+    key ^= key >> 16; key *= 0x85EBCA6Bu; key ^= key >> 13; key *= 0xC2B2AE35u; key ^= key >> 16;
+    return key;
+}
+
+static void StorageRebuildHashIndex(ImGuiStorage* storage, int capacity)
+{
+    IM_ASSERT((capacity & (capacity - 1)) == 0 && capacity >= storage->Data.Size * 2);
+    storage->HashIndex.resize(capacity);
+    memset(storage->HashIndex.Data, 0xFF, (size_t)capacity * sizeof(int));
+    const ImU32 mask = (ImU32)capacity - 1;
+    for (int n = 0; n < storage->Data.Size; n++)
+    {
+        ImU32 slot = StorageHashKey(storage->Data[n].key) & mask;
+        while (storage->HashIndex[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashIndex[slot] = n;
+    }
+}
+
+static ImGuiStorage::Pair* StorageFind(const ImGuiStorage* storage, ImGuiID key)
+{
+    ImVector<ImGuiStorage::Pair>& data = const_cast<ImVector<ImGuiStorage::Pair>&>(storage->Data);
+    if (storage->HashIndex.Size > 0)
+    {
+        const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+        for (ImU32 slot = StorageHashKey(key) & mask; ; slot = (slot + 1) & mask)
+        {
+            const int idx = storage->HashIndex.Data[slot];
+            if (idx == -1)
+                return NULL;
+            if (data.Data[idx].key == key)
+                return &data.Data[idx];
+        }
+    }
+    ImGuiStorage::Pair* it = LowerBound(data, key);
+    return (it == data.end() || it->key != key) ? NULL : it;
+}
+
+// Insert a pair which key is known to be missing from the storage.
+static ImGuiStorage::Pair* StorageInsert(ImGuiStorage* storage, const ImGuiStorage::Pair& pair)
+{
+    // Storages switch to the hashed layout on their first insertion after io.ConfigStorageUseHashMap has been set on the current context.
+    ImGuiContext* ctx = GImGui;
+    if (storage->HashIndex.Size == 0 && ctx != NULL && ctx->IO.ConfigStorageUseHashMap)
+        StorageRebuildHashIndex(storage, ImUpperPowerOfTwo(ImMax(16, (storage->Data.Size + 1) * 2)));
+    if (storage->HashIndex.Size == 0)
+        return storage->Data.insert(LowerBound(storage->Data, pair.key), pair);
+
+    storage->Data.push_back(pair);
+    if (storage->Data.Size * 2 > storage->HashIndex.Size)
+    {
+        StorageRebuildHashIndex(storage, storage->HashIndex.Size * 2);
+    }
+    else
+    {
+        const ImU32 mask = (ImU32)storage->HashIndex.Size - 1;
+        ImU32 slot = StorageHashKey(pair.key) & mask;
+        while (storage->HashIndex[slot] != -1)
+            slot = (slot + 1) & mask;
+        storage->HashIndex[slot] = storage->Data.Size - 1;
+    }
+    return &storage->Data.back();
+}
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -1900,14 +2231,21 @@ void ImGuiStorage::BuildSortByKey()
     };
     if (Data.Size > 1)
         ImQsort(Data.Data, (size_t)Data.Size, sizeof(Pair), StaticFunc::PairCompareByID);
+    if (HashIndex.Size > 0)
+        StorageRebuildHashIndex(this, ImUpperPowerOfTwo(ImMax(16, Data.Size * 2)));
+}
+
+// Switch to the hashed layout now, regardless of io.ConfigStorageUseHashMap. The storage stays hashed until Clear() is called.
+void ImGuiStorage::BuildHashIndex()
+{
+    if (HashIndex.Size == 0)
+        StorageRebuildHashIndex(this, ImUpperPowerOfTwo(ImMax(16, Data.Size * 2)));
 }
 
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_i;
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    return it ? it->val_i : default_val;
 }
 
 bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
@@ -1917,26 +2255,22 @@ bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
 
 float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return default_val;
-    return it->val_f;
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    return it ? it->val_f : default_val;
 }
 
 void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
 {
-    ImGuiStorage::Pair* it = LowerBound(const_cast<ImVector<ImGuiStorage::Pair>&>(Data), key);
-    if (it == Data.end() || it->key != key)
-        return NULL;
-    return it->val_p;
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    return it ? it->val_p : NULL;
 }
 
 // References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
 int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
+        it = StorageInsert(this, Pair(key, default_val));
     return &it->val_i;
 }
 
@@ -1947,27 +2281,27 @@ bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
 
 float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
+        it = StorageInsert(this, Pair(key, default_val));
     return &it->val_f;
 }
 
 void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
-        it = Data.insert(it, Pair(key, default_val));
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
+        it = StorageInsert(this, Pair(key, default_val));
     return &it->val_p;
 }
 
 // FIXME-OPT: Need a way to reuse the result of lower_bound when doing GetInt()/SetInt() - not too bad because it only happens on explicit interaction (maximum one a frame)
 void ImGuiStorage::SetInt(ImGuiID key, int val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
     {
-        Data.insert(it, Pair(key, val));
+        StorageInsert(this, Pair(key, val));
         return;
     }
     it->val_i = val;
@@ -1980,10 +2314,10 @@ void ImGuiStorage::SetBool(ImGuiID key, bool val)
 
 void ImGuiStorage::SetFloat(ImGuiID key, float val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
     {
-        Data.insert(it, Pair(key, val));
+        StorageInsert(this, Pair(key, val));
         return;
     }
     it->val_f = val;
@@ -1991,10 +2325,10 @@ void ImGuiStorage::SetFloat(ImGuiID key, float val)
 
 void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
 {
-    ImGuiStorage::Pair* it = LowerBound(Data, key);
-    if (it == Data.end() || it->key != key)
+    ImGuiStorage::Pair* it = StorageFind(this, key);
+    if (!it)
     {
-        Data.insert(it, Pair(key, val));
+        StorageInsert(this, Pair(key, val));
         return;
     }
     it->val_p = val;
@@ -2205,6 +2539,8 @@ void ImGuiListClipper::Begin(int count, float items_height)
     StartPosY = ImGui::GetCursorPosY();
     ItemsHeight = items_height;
     ItemsCount = count;
+    ItemsHeights = NULL;
+    ItemPosY = StartPosY;
     StepNo = 0;
     DisplayEnd = DisplayStart = -1;
     if (ItemsHeight > 0.0f)
@@ -2216,10 +2552,37 @@ void ImGuiListClipper::Begin(int count, float items_height)
     }
 }
 
+// Use case C: Begin() called from constructor with items_heights, Step() then returns the visible items one at a time to measure them
+void ImGuiListClipper::Begin(int count, ImGuiListClipperHeights* items_heights)
+{
+    IM_ASSERT(items_heights != NULL && count >= 0);
+    IM_ASSERT(count < INT_MAX && "Variable height items need a known items count, as a height is stored for each item.");
+    StartPosY = ImGui::GetCursorPosY();
+    ItemsHeight = -1.0f;
+    ItemsCount = count;
+    ItemsHeights = items_heights;
+    ItemPosY = StartPosY;
+    StepNo = 0;
+    DisplayEnd = DisplayStart = -1;
+    if (items_heights->DefaultHeight <= 0.0f)
+        items_heights->DefaultHeight = ImGui::GetTextLineHeightWithSpacing();
+    if (items_heights->Size() != count)
+        items_heights->Resize(count);
+}
+
 void ImGuiListClipper::End()
 {
     if (ItemsCount < 0)
         return;
+    if (ItemsHeights)
+    {
+        // Seek to the end of the list, using the height learned or assumed for each item
+        const float last_item_height = ItemsCount > 0 ? ItemsHeights->Heights[ItemsCount - 1] : ItemsHeights->DefaultHeight;
+        SetCursorPosYAndSetupDummyPrevLine(StartPosY + ItemsHeights->GetTotalHeight(), last_item_height);
+        ItemsCount = -1;
+        StepNo = 3;
+        return;
+    }
     // In theory here we should assert that ImGui::GetCursorPosY() == StartPosY + DisplayEnd * ItemsHeight, but it feels saner to just seek at the end and not assert/crash the user.
     if (ItemsCount < INT_MAX)
         SetCursorPosYAndSetupDummyPrevLine(StartPosY + ItemsCount * ItemsHeight, ItemsHeight); // advance cursor
@@ -2227,6 +2590,64 @@ void ImGuiListClipper::End()
     StepNo = 3;
 }
 
+// Step() when using ImGuiListClipperHeights: seek to the first visible item, then return items one by one until we are past the visible area.
+static bool ListClipperStepVariableHeights(ImGuiListClipper* clipper)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = g.CurrentWindow;
+    ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+
+    // Same visible area as CalcListClipping(): union of the ClipRect and the NavScoringRect
+    ImRect unclipped_rect = window->ClipRect;
+    if (g.NavMoveRequest)
+        unclipped_rect.Add(g.NavScoringRectScreen);
+
+    if (clipper->StepNo == 0)
+    {
+        int start = 0;
+        if (!g.LogEnabled)
+        {
+            start = heights->FindItem(unclipped_rect.Min.y - window->DC.CursorPos.y);
+            if (g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Up)
+                start--;
+            start = ImClamp(start, 0, clipper->ItemsCount);
+        }
+        if (start == clipper->ItemsCount)
+        {
+            clipper->End();
+            return false;
+        }
+        if (start > 0)
+            SetCursorPosYAndSetupDummyPrevLine(clipper->StartPosY + heights->GetOffset(start), heights->Heights[start - 1]);
+        clipper->ItemPosY = ImGui::GetCursorPosY();
+        clipper->DisplayStart = start;
+        clipper->DisplayEnd = start + 1;
+        clipper->StepNo = 1;
+        return true;
+    }
+
+    // Learn the height of the item we just displayed
+    const float item_height = ImGui::GetCursorPosY() - clipper->ItemPosY;
+    const int item_idx = clipper->DisplayStart;
+    if (item_height >= 0.0f && heights->Heights[item_idx] != item_height)
+        heights->SetHeight(item_idx, item_height);
+
+    // Stop when the cursor is past the visible area. When performing a navigation request, ensure we have one item extra in the direction we are moving to.
+    const float item_start_y = window->DC.CursorPos.y - item_height;
+    bool visible = g.LogEnabled || window->DC.CursorPos.y < unclipped_rect.Max.y;
+    if (!visible && g.NavMoveRequest && g.NavMoveClipDir == ImGuiDir_Down && item_start_y < unclipped_rect.Max.y)
+        visible = true;
+    if (!visible || item_idx + 1 >= clipper->ItemsCount)
+    {
+        clipper->End();
+        return false;
+    }
+    clipper->ItemPosY = ImGui::GetCursorPosY();
+    clipper->DisplayStart = item_idx + 1;
+    clipper->DisplayEnd = item_idx + 2;
+    return true;
+}
+
 bool ImGuiListClipper::Step()
 {
     if (ItemsCount == 0 || ImGui::GetCurrentWindowRead()->SkipItems)
@@ -2234,6 +2655,8 @@ bool ImGuiListClipper::Step()
         ItemsCount = -1;
         return false;
     }
+    if (ItemsHeights)
+        return ListClipperStepVariableHeights(this);
     if (StepNo == 0) // Step 0: the clipper let you process the first element, regardless of it being visible or not, so we can measure the element height.
     {
         DisplayStart = 0;
@@ -2264,6 +2687,71 @@ bool ImGuiListClipper::Step()
     return false;
 }
 
+// Fenwick tree (binary indexed tree) of the items heights, so that prefix sums and updates are O(log N)
+// Sums[i-1] stores the sum of the Heights of the items in the [i - (i & -i), i) range.
+static double ListClipperHeightsPrefixSum(const ImVector<double>& sums, int items_count)
+{
+    double sum = 0.0;
+    for (int i = items_count; i > 0; i -= (i & -i))
+        sum += sums[i - 1];
+    return sum;
+}
+
+void ImGuiListClipperHeights::Resize(int items_count)
+{
+    IM_ASSERT(items_count >= 0);
+    if (items_count <= Heights.Size)
+    {
+        // Removing items at the end doesn't affect the ranges of the remaining ones
+        Heights.resize(items_count);
+        Sums.resize(items_count);
+        return;
+    }
+    Heights.reserve(items_count);
+    Sums.reserve(items_count);
+    for (int i = Heights.Size + 1; i <= items_count; i++)
+    {
+        // The range of node i is made of item i-1 and of the ranges of nodes i-1, i-2, i-4.. down to i - (i & -i) (amortized O(1) per item)
+        double sum = DefaultHeight;
+        for (int child_step = 1; child_step < (i & -i); child_step <<= 1)
+            sum += Sums[i - child_step - 1];
+        Heights.push_back(DefaultHeight);
+        Sums.push_back(sum);
+    }
+}
+
+void ImGuiListClipperHeights::SetHeight(int item_idx, float height)
+{
+    IM_ASSERT(item_idx >= 0 && item_idx < Heights.Size && height >= 0.0f);
+    const double delta = (double)height - Heights[item_idx];
+    Heights[item_idx] = height;
+    for (int i = item_idx + 1; i <= Sums.Size; i += (i & -i))
+        Sums[i - 1] += delta;
+}
+
+float ImGuiListClipperHeights::GetOffset(int item_idx) const
+{
+    IM_ASSERT(item_idx >= 0 && item_idx <= Sums.Size);
+    return (float)ListClipperHeightsPrefixSum(Sums, item_idx);
+}
+
+int ImGuiListClipperHeights::FindItem(float offset) const
+{
+    // Descend the tree to find the last item starting at or before 'offset'
+    int step = 1;
+    while (step * 2 <= Sums.Size)
+        step *= 2;
+    int item_idx = 0;
+    double remaining = offset;
+    for (; step > 0; step >>= 1)
+        if (item_idx + step <= Sums.Size && Sums[item_idx + step - 1] <= remaining)
+        {
+            item_idx += step;
+            remaining -= Sums[item_idx - 1];
+        }
+    return item_idx;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] RENDER HELPERS
 // Those (internal) functions are currently quite a legacy mess - their signature and behavior will change.
@@ -2521,6 +3009,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     SkipItems = false;
     Appearing = false;
     Hidden = false;
+    Occluded = false;
     HasCloseButton = false;
     ResizeBorderHeld = -1;
     BeginCount = 0;
@@ -2532,6 +3021,7 @@ ImGuiWindow::ImGuiWindow(ImGuiContext* context, const char* name)
     AutoFitChildAxises = 0x00;
     AutoPosLastDirection = ImGuiDir_None;
     HiddenFramesRegular = HiddenFramesForResize = 0;
+    OccludedFrames = OccludedVtxCount = 0;
     SetWindowPosAllowFlags = SetWindowSizeAllowFlags = SetWindowCollapsedAllowFlags = ImGuiCond_Always | ImGuiCond_Once | ImGuiCond_FirstUseEver | ImGuiCond_Appearing;
     SetWindowPosVal = SetWindowPosPivot = ImVec2(FLT_MAX, FLT_MAX);
 
@@ -2951,10 +3441,26 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
     return ImMax(wrap_pos_x - pos.x, 1.0f);
 }
 
+// The allocation counters are updated atomically, as draw list jobs may allocate from worker threads (see io.DrawListJobsDispatchFn)
+static inline void ImAtomicAdd(volatile int* p, int v)
+{
+#if defined(_MSC_VER)
+    _InterlockedExchangeAdd((volatile long*)p, (long)v);
+#elif defined(__GNUC__) || defined(__clang__)
+    __sync_fetch_and_add(p, v);
+#else
+    *p += v; // FIXME: Not atomic with this compiler, the counters may be off when draw list jobs run on worker threads
+#endif
+}
+
 void* ImGui::MemAlloc(size_t size)
 {
     if (ImGuiContext* ctx = GImGui)
-        ctx->IO.MetricsActiveAllocations++;
+    {
+        ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, 1);
+        ImAtomicAdd(&ctx->FrameHeapAllocCount, 1);
+        ImAtomicAdd(&ctx->FrameHeapAllocBytes, (int)size);
+    }
     return GImAllocatorAllocFunc(size, GImAllocatorUserData);
 }
 
@@ -2962,10 +3468,77 @@ void ImGui::MemFree(void* ptr)
 {
     if (ptr)
         if (ImGuiContext* ctx = GImGui)
-            ctx->IO.MetricsActiveAllocations--;
+            ImAtomicAdd(&ctx->IO.MetricsActiveAllocations, -1);
     return GImAllocatorFreeFunc(ptr, GImAllocatorUserData);
 }
 
+void* ImFrameArena::Alloc(size_t size)
+{
+    size = (size + 15) & ~(size_t)15; // Keep all allocations 16-bytes aligned (assuming MemAlloc() is)
+    while (BlockIdx < Blocks.Size && (size_t)BlockOffset + size > (size_t)Blocks[BlockIdx].Size)
+    {
+        BlockIdx++;
+        BlockOffset = 0;
+    }
+    if (BlockIdx == Blocks.Size)
+    {
+        Block block;
+        block.Size = ImMax(BlockMinSize, (int)size);
+        block.Data = (char*)ImGui::MemAlloc((size_t)block.Size);
+        Blocks.push_back(block);
+    }
+    void* ptr = Blocks[BlockIdx].Data + BlockOffset;
+    BlockOffset += (int)size;
+    UsedBytes += (int)size;
+    return ptr;
+}
+
+void ImFrameArena::Reset()
+{
+    // Replace multiple blocks with a single one large enough for the last frame, so next frame with the same usage won't need to allocate.
+    // Also replace a single block much larger than what the last frame used.
+    const int capacity = GetCapacity();
+    const int used_bytes = UsedBytes;
+    if (Blocks.Size > 1 || (capacity > BlockMinSize && capacity > used_bytes * 4))
+    {
+        Clear();
+        Block block;
+        block.Size = ImMax(BlockMinSize, used_bytes);
+        block.Data = (char*)ImGui::MemAlloc((size_t)block.Size);
+        Blocks.push_back(block);
+    }
+    BlockIdx = BlockOffset = UsedBytes = 0;
+}
+
+void ImFrameArena::Clear()
+{
+    for (int n = 0; n < Blocks.Size; n++)
+        ImGui::MemFree(Blocks[n].Data);
+    Blocks.clear();
+    BlockIdx = BlockOffset = UsedBytes = 0;
+}
+
+void* ImGui::MemAllocFrame(size_t size)
+{
+    ImGuiContext& g = *GImGui;
+    g.FrameArenaAllocCount++;
+    g.FrameArenaAllocBytes += (int)size;
+    if (g.FrameAllocFunc)
+        return g.FrameAllocFunc(size, g.FrameAllocUserData);
+    return g.FrameArena.Alloc(size);
+}
+
+void ImGui::SetFrameAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*reset_func)(void* user_data), void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    IM_ASSERT((alloc_func != NULL) == (reset_func != NULL));
+    g.FrameAllocFunc = alloc_func;
+    g.FrameResetFunc = reset_func;
+    g.FrameAllocUserData = user_data;
+    if (alloc_func != NULL)
+        g.FrameArena.Clear();
+}
+
 const char* ImGui::GetClipboardText()
 {
     return GImGui->IO.GetClipboardTextFn ? GImGui->IO.GetClipboardTextFn(GImGui->IO.ClipboardUserData) : "";
@@ -3019,6 +3592,13 @@ void ImGui::SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data
     GImAllocatorUserData = user_data;
 }
 
+void ImGui::GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data)
+{
+    *p_alloc_func = GImAllocatorAllocFunc;
+    *p_free_func = GImAllocatorFreeFunc;
+    *p_user_data = GImAllocatorUserData;
+}
+
 ImGuiContext* ImGui::CreateContext(ImFontAtlas* shared_font_atlas)
 {
     ImGuiContext* ctx = IM_NEW(ImGuiContext)(shared_font_atlas);
@@ -3083,6 +3663,41 @@ ImDrawListSharedData* ImGui::GetDrawListSharedData()
     return &GImGui->DrawListSharedData;
 }
 
+// The job draw list is setup with the current window state (flags, texture, clipping rectangle) and a private copy of the shared data (font, etc.).
+// The callback will be called during Render(), either serially or on worker threads if io.DrawListJobsDispatchFn is set.
+void ImGui::AddDrawListJob(ImDrawListJobCallback callback, void* user_data)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindow* window = GetCurrentWindow();
+    IM_ASSERT(callback != NULL);
+    if (window->SkipItems)
+        return;
+
+    if (g.DrawListJobsCount == g.DrawListJobs.Size)
+        g.DrawListJobs.push_back(IM_NEW(ImDrawListJob)());
+    ImDrawListJob* job = g.DrawListJobs[g.DrawListJobsCount++];
+    job->SharedData = g.DrawListSharedData;
+    job->SharedData.GlyphRunCache = NULL; // The text caches are not thread-safe
+    job->SharedData.WrapLayoutCache = NULL;
+    job->SharedData.GlyphsToLoad = &job->GlyphsToLoad; // Fonts are read-only while jobs run
+    job->GlyphsToLoad.resize(0);
+    job->Callback = callback;
+    job->UserData = user_data;
+
+    ImDrawList* draw_list = &job->DrawList;
+    draw_list->Clear();
+    draw_list->Flags = window->DrawList->Flags;
+    draw_list->_OwnerName = window->Name;
+    draw_list->PushTextureID(window->DrawList->_TextureIdStack.back());
+    draw_list->PushClipRect(window->ClipRect.Min, window->ClipRect.Max);
+    window->DrawListJobs.push_back(job);
+}
+
+void ImGui::RunDrawListJob(ImDrawListJob* job)
+{
+    job->Callback(&job->DrawList, job->UserData);
+}
+
 void ImGui::StartMouseMovingWindow(ImGuiWindow* window)
 {
     // Set ActiveId even if the _NoMove flag is set. Without it, dragging away from a window with _NoMove would activate hover on other windows.
@@ -3413,18 +4028,60 @@ void ImGui::NewFrame()
     g.FrameCount += 1;
     g.TooltipOverrideCount = 0;
     g.WindowsActiveCount = 0;
+    g.WindowsOccludedCountPrev = g.WindowsOccludedCount;
+    g.WindowsOccludedVtxCountPrev = g.WindowsOccludedVtxCount;
+    g.WindowsOccludedCount = g.WindowsOccludedVtxCount = 0;
+
+    // Release transient memory from the previous frame
+    g.FrameHeapAllocCountPrev = g.FrameHeapAllocCount;
+    g.FrameHeapAllocBytesPrev = g.FrameHeapAllocBytes;
+    g.FrameArenaAllocCountPrev = g.FrameArenaAllocCount;
+    g.FrameArenaAllocBytesPrev = g.FrameArenaAllocBytes;
+    g.FrameHeapAllocCount = g.FrameHeapAllocBytes = g.FrameArenaAllocCount = g.FrameArenaAllocBytes = 0;
+    if (g.FrameResetFunc)
+        g.FrameResetFunc(g.FrameAllocUserData);
+    else
+        g.FrameArena.Reset();
 
     // Setup current font and draw list shared data
     g.IO.Fonts->Locked = true;
+    ImFontAtlasDynamicGlyphsNewFrame(g.IO.Fonts);
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
     g.DrawListSharedData.ClipRectFullscreen = ImVec4(0.0f, 0.0f, g.IO.DisplaySize.x, g.IO.DisplaySize.y);
     g.DrawListSharedData.CurveTessellationTol = g.Style.CurveTessellationTol;
 
+    // Update glyph-run cache (discard old runs, invalidate on font atlas changes)
+    if (g.IO.ConfigTextGlyphRunCache)
+    {
+        g.GlyphRunCache.NewFrame(g.IO.Fonts);
+        g.DrawListSharedData.GlyphRunCache = &g.GlyphRunCache;
+    }
+    else if (g.DrawListSharedData.GlyphRunCache)
+    {
+        g.GlyphRunCache.Clear();
+        g.DrawListSharedData.GlyphRunCache = NULL;
+    }
+
+    // Update wrap layout cache (discard old layouts, invalidate on font atlas changes)
+    if (g.IO.ConfigTextWrapLayoutCache)
+    {
+        g.WrapLayoutCache.NewFrame(g.IO.Fonts);
+        g.DrawListSharedData.WrapLayoutCache = &g.WrapLayoutCache;
+    }
+    else if (g.DrawListSharedData.WrapLayoutCache)
+    {
+        g.WrapLayoutCache.Clear();
+        g.DrawListSharedData.WrapLayoutCache = NULL;
+    }
+
     g.OverlayDrawList.Clear();
     g.OverlayDrawList.PushTextureID(g.IO.Fonts->TexID);
     g.OverlayDrawList.PushClipRectFullScreen();
     g.OverlayDrawList.Flags = (g.Style.AntiAliasedLines ? ImDrawListFlags_AntiAliasedLines : 0) | (g.Style.AntiAliasedFill ? ImDrawListFlags_AntiAliasedFill : 0);
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
+        g.OverlayDrawList.Flags |= ImDrawListFlags_AllowVtxOffset;
+    g.DrawListJobsCount = 0;
 
     // Mark rendering data as invalid to prevent user who may have a handle on it to use it.
     g.DrawData.Clear();
@@ -3589,6 +4246,7 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.Windows.clear();
     g.WindowsFocusOrder.clear();
     g.WindowsSortBuffer.clear();
+    g.WindowsHitGrid.Clear();
     g.CurrentWindow = NULL;
     g.CurrentWindowStack.clear();
     g.WindowsById.Clear();
@@ -3603,10 +4261,20 @@ void ImGui::Shutdown(ImGuiContext* context)
     g.BeginPopupStack.clear();
     g.DrawDataBuilder.ClearFreeMemory();
     g.OverlayDrawList.ClearFreeMemory();
+    for (int i = 0; i < g.DrawListJobs.Size; i++)
+        IM_DELETE(g.DrawListJobs[i]);
+    g.DrawListJobs.clear();
+    g.DrawListJobsCount = 0;
+    g.FrameArena.Clear();
+    g.GlyphRunCache.Clear();
+    g.DrawListSharedData.GlyphRunCache = NULL;
+    g.WrapLayoutCache.Clear();
+    g.DrawListSharedData.WrapLayoutCache = NULL;
     g.PrivateClipboard.clear();
     g.InputTextState.TextW.clear();
     g.InputTextState.InitialText.clear();
     g.InputTextState.TempBuffer.clear();
+    g.InputTextState.Lines.clear();
 
     for (int i = 0; i < g.SettingsWindows.Size; i++)
         IM_DELETE(g.SettingsWindows[i].Name);
@@ -3669,19 +4337,54 @@ static void AddDrawListToDrawData(ImVector<ImDrawList*>* out_list, ImDrawList* d
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc. May trigger for you if you are using PrimXXX functions incorrectly.
     IM_ASSERT(draw_list->VtxBuffer.Size == 0 || draw_list->_VtxWritePtr == draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size);
     IM_ASSERT(draw_list->IdxBuffer.Size == 0 || draw_list->_IdxWritePtr == draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size);
-    IM_ASSERT((int)draw_list->_VtxCurrentIdx == draw_list->VtxBuffer.Size);
+    IM_ASSERT((int)(draw_list->_VtxCurrentOffset + draw_list->_VtxCurrentIdx) == draw_list->VtxBuffer.Size);
 
     // Check that draw_list doesn't use more vertices than indexable (default ImDrawIdx = unsigned short = 2 bytes = 64K vertices per ImDrawList = per window)
     // If this assert triggers because you are drawing lots of stuff manually:
     // A) Make sure you are coarse clipping, because ImDrawList let all your vertices pass. You can use the Metrics window to inspect draw list contents.
-    // B) If you need/want meshes with more than 64K vertices, uncomment the '#define ImDrawIdx unsigned int' line in imconfig.h to set the index size to 4 bytes.
+    // B) If you need/want meshes with more than 64K vertices, the preferred solution is to make your renderer honor ImDrawCmd::VtxOffset and set 'io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset'.
+    //    The draw list will then start a new command with a vertex offset instead of overflowing 16-bit indices. Most examples renderers support it (e.g. using glDrawElementsBaseVertex() with OpenGL 3.2+).
+    // C) Or uncomment the '#define ImDrawIdx unsigned int' line in imconfig.h to set the index size to 4 bytes.
     //    You'll need to handle the 4-bytes indices to your renderer. For example, the OpenGL example code detect index size at compile-time by doing:
     //      glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer_offset);
     //    Your own engine or render API may use different parameters or function calls to specify index sizes. 2 and 4 bytes indices are generally supported by most API.
-    // C) If for some reason you cannot use 4 bytes indices or don't want to, a workaround is to call BeginChild()/EndChild() before reaching the 64K limit to split your draw commands in multiple draw lists.
+    // D) If for some reason you cannot use any of the above, a workaround is to call BeginChild()/EndChild() before reaching the 64K limit to split your draw commands in multiple draw lists.
     if (sizeof(ImDrawIdx) == 2)
         IM_ASSERT(draw_list->_VtxCurrentIdx < (1 << 16) && "Too many vertices in ImDrawList using 16-bit indices. Read comment above");
 
+    // Detect if content changed since the last time this list was rendered, so back-ends can skip uploading it (only if they request it, as hashing all vertices isn't free)
+    ImGuiContext& g = *GImGui;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasContentHash)
+    {
+        // Hash ImDrawCmd fields individually, as the structure may contain padding. Hashing costs about twice a memcpy() of the same buffers
+        // (see the content_hash workload of the example_null harness), so it only pays off when uploading is more expensive than that
+        // (driver calls, bus transfers) and most lists are unchanged. If your lists are known to change every frame, don't set the flag.
+        ImU64 hash = (ImU64)draw_list->CmdBuffer.Size;
+        for (const ImDrawCmd* cmd = draw_list->CmdBuffer.begin(); cmd != draw_list->CmdBuffer.end(); cmd++)
+        {
+            ImU64 clip_rect[2];
+            memcpy(clip_rect, &cmd->ClipRect, sizeof(clip_rect));
+            hash = ImHashMix64(hash, ((ImU64)cmd->VtxOffset << 32) | cmd->ElemCount);
+            hash = ImHashMix64(hash, clip_rect[0]);
+            hash = ImHashMix64(hash, clip_rect[1]);
+            hash = ImHashData64(&cmd->TextureId, sizeof(cmd->TextureId), hash); // User-defined type
+            hash = ImHashMix64(hash, (ImU64)(intptr_t)cmd->UserCallback);
+            hash = ImHashMix64(hash, (ImU64)(intptr_t)cmd->UserCallbackData);
+        }
+        hash = ImHashData64(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), hash);
+        hash = ImHashData64(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), hash);
+        draw_list->_ContentHashPrev = draw_list->ContentHash;
+        draw_list->ContentHash = hash;
+        draw_list->_ContentChanged = (draw_list->ContentHash != draw_list->_ContentHashPrev);
+    }
+    else
+    {
+        draw_list->_ContentHashPrev = draw_list->ContentHash = 0;
+        draw_list->_ContentChanged = true;
+    }
+    if (draw_list->_ContentChanged)
+        draw_list->ContentGeneration++;
+
     out_list->push_back(draw_list);
 }
 
@@ -3690,6 +4393,8 @@ static void AddWindowToDrawData(ImVector<ImDrawList*>* out_render_list, ImGuiWin
     ImGuiContext& g = *GImGui;
     g.IO.MetricsRenderWindows++;
     AddDrawListToDrawData(out_render_list, window->DrawList);
+    for (int i = 0; i < window->DrawListJobs.Size; i++)
+        AddDrawListToDrawData(out_render_list, &window->DrawListJobs[i]->DrawList);
     for (int i = 0; i < window->DC.ChildWindows.Size; i++)
     {
         ImGuiWindow* child = window->DC.ChildWindows[i];
@@ -3731,13 +4436,14 @@ static void SetupDrawData(ImVector<ImDrawList*>* draw_lists, ImDrawData* draw_da
     draw_data->Valid = true;
     draw_data->CmdLists = (draw_lists->Size > 0) ? draw_lists->Data : NULL;
     draw_data->CmdListsCount = draw_lists->Size;
-    draw_data->TotalVtxCount = draw_data->TotalIdxCount = 0;
+    draw_data->TotalVtxCount = draw_data->TotalIdxCount = draw_data->CmdListsChangedCount = 0;
     draw_data->DisplayPos = ImVec2(0.0f, 0.0f);
     draw_data->DisplaySize = io.DisplaySize;
     for (int n = 0; n < draw_lists->Size; n++)
     {
         draw_data->TotalVtxCount += draw_lists->Data[n]->VtxBuffer.Size;
         draw_data->TotalIdxCount += draw_lists->Data[n]->IdxBuffer.Size;
+        draw_data->CmdListsChangedCount += draw_lists->Data[n]->_ContentChanged ? 1 : 0;
     }
 }
 
@@ -3839,6 +4545,9 @@ void ImGui::EndFrame()
     g.Windows.swap(g.WindowsSortBuffer);
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
+    // Build spatial index of the hoverable windows, in display order, for FindHoveredWindow() on the next frame
+    UpdateWindowsHitGrid();
+
     // Unlock font atlas
     g.IO.Fonts->Locked = false;
 
@@ -3857,6 +4566,25 @@ void ImGui::Render()
         EndFrame();
     g.FrameCountRendered = g.FrameCount;
 
+    // Run draw list jobs (possibly on worker threads), their output is gathered below in submission order
+    if (g.DrawListJobsCount > 0)
+    {
+        if (g.IO.DrawListJobsDispatchFn != NULL)
+            g.IO.DrawListJobsDispatchFn(g.DrawListJobs.Data, g.DrawListJobsCount, g.IO.DrawListJobsUserData);
+        else
+            for (int n = 0; n < g.DrawListJobsCount; n++)
+                RunDrawListJob(g.DrawListJobs[n]);
+
+        // Back on the main thread: load the glyphs jobs found missing (ImFontAtlasFlags_DynamicGlyphs), they'll be drawn from the next frame on
+        for (int n = 0; n < g.DrawListJobsCount; n++)
+        {
+            ImVector<ImFontGlyphToLoad>& glyphs_to_load = g.DrawListJobs[n]->GlyphsToLoad;
+            for (int glyph_n = 0; glyph_n < glyphs_to_load.Size; glyph_n++)
+                glyphs_to_load[glyph_n].Font->FindGlyph(glyphs_to_load[glyph_n].Codepoint);
+            glyphs_to_load.resize(0);
+        }
+    }
+
     // Gather ImDrawList to render (for each active window)
     g.IO.MetricsRenderVertices = g.IO.MetricsRenderIndices = g.IO.MetricsRenderWindows = 0;
     g.DrawDataBuilder.Clear();
@@ -3886,6 +4614,22 @@ void ImGui::Render()
     g.IO.MetricsRenderVertices = g.DrawData.TotalVtxCount;
     g.IO.MetricsRenderIndices = g.DrawData.TotalIdxCount;
 
+    // Sum text rendering counters of the rendered draw lists per font (see ImFont::MetricsText)
+    ImVector<ImFont*>& fonts = g.IO.Fonts->Fonts;
+    for (int font_n = 0; font_n < fonts.Size; font_n++)
+    {
+        fonts[font_n]->MetricsText.Clear();
+        fonts[font_n]->MetricsText.Font = fonts[font_n];
+    }
+    for (int list_n = 0; list_n < g.DrawData.CmdListsCount; list_n++)
+    {
+        const ImDrawList* draw_list = g.DrawData.CmdLists[list_n];
+        for (int stats_n = 0; stats_n < draw_list->_TextStats.Size; stats_n++)
+            for (int font_n = 0; font_n < fonts.Size; font_n++)
+                if (fonts[font_n] == draw_list->_TextStats[stats_n].Font)
+                    fonts[font_n]->MetricsText.Add(draw_list->_TextStats[stats_n]);
+    }
+
     // (Legacy) Call the Render callback function. The current prefer way is to let the user retrieve GetDrawData() and call the render function themselves.
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     if (g.DrawData.CmdListsCount > 0 && g.IO.RenderDrawListsFn != NULL)
@@ -3903,24 +4647,58 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     if (hide_text_after_double_hash)
         text_display_end = FindRenderedTextEnd(text, text_end);      // Hide anything after a '##' string
     else
-        text_display_end = text_end;
+        text_display_end = text_end ? text_end : text + strlen(text); // Text caches need the text length
 
     ImFont* font = g.Font;
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    ImVec2 text_size;
+    if (g.DrawListSharedData.WrapLayoutCache && wrap_width > 0.0f && (!g.DrawListSharedData.GlyphRunCache || (int)(text_display_end - text) > g.GlyphRunCache.TextMaxLength))
+        text_size = g.WrapLayoutCache.CalcTextSize(font, font_size, wrap_width, text, text_display_end);
+    else if (g.DrawListSharedData.GlyphRunCache)
+        text_size = g.GlyphRunCache.CalcTextSize(font, font_size, wrap_width, text, text_display_end);
+    else
+        text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    return CalcTextSizeFinalize(font, font_size, text_size);
+}
 
-    // Cancel out character spacing for the last character of a line (it is baked into glyph->AdvanceX field)
+// Cancel out character spacing for the last character of a line (it is baked into glyph->AdvanceX field)
+static ImVec2 CalcTextSizeFinalize(const ImFont* font, float font_size, ImVec2 text_size)
+{
     const float font_scale = font_size / font->FontSize;
     const float character_spacing_x = 1.0f * font_scale;
     if (text_size.x > 0.0f)
         text_size.x -= character_spacing_x;
     text_size.x = (float)(int)(text_size.x + 0.95f);
-
     return text_size;
 }
 
+// Word-wrapped text which is clipped with its size from a previous wrap width doesn't need to be wrapped again (e.g. while resizing a window).
+// The returned size is corrected once the text becomes visible, or within a few frames (see ImFontWrapLayoutCache::LazyBudget).
+// Requires io.ConfigTextWrapLayoutCache, otherwise same as CalcTextSize().
+ImVec2 ImGui::CalcTextSizeWrappedLazy(const char* text, const char* text_end, float wrap_width, const ImVec2& pos)
+{
+    ImGuiContext& g = *GImGui;
+    if (!text_end)
+        text_end = text + strlen(text);
+    if (g.DrawListSharedData.WrapLayoutCache && wrap_width > 0.0f && text != text_end && (!g.DrawListSharedData.GlyphRunCache || (int)(text_end - text) > g.GlyphRunCache.TextMaxLength))
+    {
+        const ImFontWrapLayout* layout = g.WrapLayoutCache.GetLayout(g.Font, g.FontSize, wrap_width, text, text_end, true);
+        if (layout->WrapWidth != wrap_width)
+        {
+            const ImVec2 text_size = CalcTextSizeFinalize(g.Font, g.FontSize, layout->TextSize);
+            if (IsClippedEx(ImRect(pos, pos + text_size), 0, false))
+            {
+                if (g.WrapLayoutCache.LazyBytes + layout->TextLength > g.WrapLayoutCache.LazyBudget)
+                    return text_size;
+                g.WrapLayoutCache.LazyBytes += layout->TextLength;
+            }
+        }
+    }
+    return CalcTextSize(text, text_end, false, wrap_width);
+}
+
 // Helper to calculate coarse clipping of large list of evenly sized items.
 // NB: Prefer using the ImGuiListClipper higher-level helper if you can! Read comments and instructions there on how those use this sort of pattern.
 // NB: 'items_count' is only used to clamp the result, if you don't know your count you can use INT_MAX
@@ -3962,6 +4740,162 @@ void ImGui::CalcListClipping(int items_count, float items_height, int* out_items
     *out_items_display_end = end;
 }
 
+// Bin the entries (in display order) into a uniform grid, so FindWindow() only tests the entries overlapping the cell under the point
+void ImGuiWindowHitGrid::Build(const ImRect& display_rect)
+{
+    DisplayRect = display_rect;
+    CellsStart.resize(0);
+    CellsEntries.resize(0);
+    CellsX = CellsY = 0;
+    if (Entries.Size == 0)
+        return;
+
+    // Cover the union of the rectangles, clipped to the display (windows outside of it still land in the outer cells)
+    ImRect bounds = Entries[0].Rect;
+    ImVec2 avg_size(0.0f, 0.0f);
+    for (int n = 0; n < Entries.Size; n++)
+    {
+        bounds.Add(Entries[n].Rect);
+        avg_size += Entries[n].Rect.GetSize();
+    }
+    avg_size = avg_size * (1.0f / Entries.Size);
+    if (bounds.Overlaps(display_rect))
+        bounds.ClipWith(display_rect);
+
+    // Cells at least as large as the average window, and no more than 64x64 cells
+    const int CELLS_MAX = 64;
+    const ImVec2 bounds_size = bounds.GetSize();
+    CellsX = (bounds_size.x > 0.0f) ? ImClamp((int)(bounds_size.x / ImMax(avg_size.x, bounds_size.x / CELLS_MAX)), 1, CELLS_MAX) : 1;
+    CellsY = (bounds_size.y > 0.0f) ? ImClamp((int)(bounds_size.y / ImMax(avg_size.y, bounds_size.y / CELLS_MAX)), 1, CELLS_MAX) : 1;
+    Min = bounds.Min;
+    CellSizeInv.x = (bounds_size.x > 0.0f) ? CellsX / bounds_size.x : 0.0f;
+    CellSizeInv.y = (bounds_size.y > 0.0f) ? CellsY / bounds_size.y : 0.0f;
+
+    // Count the entries of each cell, then fill the cells walking the entries back to front so each cell ends up in ascending order
+    const int cells_count = CellsX * CellsY;
+    CellsStart.resize(cells_count + 1);
+    memset(CellsStart.Data, 0, (size_t)CellsStart.size_in_bytes());
+    int* cells_start = CellsStart.Data;
+    for (int n = 0; n < Entries.Size; n++)
+    {
+        const ImRect& r = Entries[n].Rect;
+        const int x0 = GetCellX(r.Min.x), x1 = GetCellX(r.Max.x), y1 = GetCellY(r.Max.y);
+        for (int y = GetCellY(r.Min.y); y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                cells_start[y * CellsX + x]++;
+    }
+    for (int cell_n = 1; cell_n <= cells_count; cell_n++)
+        cells_start[cell_n] += cells_start[cell_n - 1];
+    CellsEntries.resize(cells_start[cells_count]);
+    int* cells_entries = CellsEntries.Data;
+    for (int n = Entries.Size - 1; n >= 0; n--)
+    {
+        const ImRect& r = Entries[n].Rect;
+        const int x0 = GetCellX(r.Min.x), x1 = GetCellX(r.Max.x), y1 = GetCellY(r.Max.y);
+        for (int y = GetCellY(r.Min.y); y <= y1; y++)
+            for (int x = x0; x <= x1; x++)
+                cells_entries[--cells_start[y * CellsX + x]] = n;
+    }
+}
+
+ImGuiWindow* ImGuiWindowHitGrid::FindWindow(const ImVec2& pos) const
+{
+    if (CellsX == 0)
+        return NULL;
+    const int cell_n = GetCellY(pos.y) * CellsX + GetCellX(pos.x);
+    for (int n = CellsStart[cell_n + 1] - 1; n >= CellsStart[cell_n]; n--)
+        if (Entries[CellsEntries[n]].Hoverable && Entries[CellsEntries[n]].Rect.Contains(pos))
+            return Entries[CellsEntries[n]].Window;
+    return NULL;
+}
+
+// Test front to back the windows overlapping the center of 'rect', up to 'window' itself.
+// Windows already submitted during the current frame use their new OccludingRect, the others use the one of the last frame.
+bool ImGuiWindowHitGrid::IsWindowOccluded(ImGuiWindow* window, const ImRect& rect) const
+{
+    if (CellsX == 0)
+        return false;
+    const ImVec2 center = rect.GetCenter();
+    const int cell_n = GetCellY(center.y) * CellsX + GetCellX(center.x);
+    bool occluded = false;
+    for (int n = CellsStart[cell_n + 1] - 1; n >= CellsStart[cell_n]; n--)
+    {
+        ImGuiWindow* occluder = Entries[CellsEntries[n]].Window;
+        if (occluder == window)
+            return occluded;
+        if (occluded || occluder->RootWindow == window) // Child windows are hidden along with their parent
+            continue;
+        const ImRect& r = occluder->OccludingRect;
+        if (r.Min.x <= rect.Min.x && r.Min.y <= rect.Min.y && r.Max.x >= rect.Max.x && r.Max.y >= rect.Max.y)
+            occluded = true;
+    }
+    return false; // Window wasn't visible on the last frame, we don't know its display order
+}
+
+static bool IsWindowHoverable(ImGuiWindow* window)
+{
+    return window->Active && !window->Hidden && !(window->Flags & ImGuiWindowFlags_NoMouseInputs);
+}
+
+static ImRect GetWindowHitRect(ImGuiWindow* window)
+{
+    // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
+    ImGuiContext& g = *GImGui;
+    ImVec2 padding_regular = g.Style.TouchExtraPadding;
+    ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS)) : padding_regular;
+    ImRect bb(window->OuterRectClipped);
+    if ((window->Flags & ImGuiWindowFlags_ChildWindow) || (window->Flags & ImGuiWindowFlags_NoResize))
+        bb.Expand(padding_regular);
+    else
+        bb.Expand(padding_for_resize_from_edges);
+    return bb;
+}
+
+static inline bool IsRectEqual(const ImRect& a, const ImRect& b)
+{
+    return a.Min.x == b.Min.x && a.Min.y == b.Min.y && a.Max.x == b.Max.x && a.Max.y == b.Max.y;
+}
+
+static void UpdateWindowsHitGrid()
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiWindowHitGrid& grid = g.WindowsHitGrid;
+
+    // Only rebuild the cells when a window moved, appeared or disappeared, or when the display order changed.
+    // Windows hidden because occluded are kept so Begin() can test them again on the next frame.
+    const ImRect display_rect(ImVec2(0.0f, 0.0f), g.IO.DisplaySize);
+    bool dirty = (grid.FrameCount == -1) || !IsRectEqual(grid.DisplayRect, display_rect);
+    int entries_count = 0;
+    for (int i = 0; i < g.Windows.Size; i++)
+    {
+        ImGuiWindow* window = g.Windows[i];
+        if (!window->Active || (window->Hidden && !window->Occluded))
+            continue;
+        ImRect rect = GetWindowHitRect(window);
+        if (entries_count == grid.Entries.Size)
+        {
+            grid.Entries.resize(entries_count + 1);
+            dirty = true;
+        }
+        ImGuiWindowHitGridEntry& entry = grid.Entries[entries_count++];
+        if (entry.Window != window || !IsRectEqual(entry.Rect, rect))
+        {
+            entry.Window = window;
+            entry.Rect = rect;
+            dirty = true;
+        }
+        entry.Hoverable = IsWindowHoverable(window);
+    }
+    if (entries_count != grid.Entries.Size)
+    {
+        grid.Entries.resize(entries_count);
+        dirty = true;
+    }
+    if (dirty)
+        grid.Build(display_rect);
+    grid.FrameCount = g.FrameCount;
+}
+
 // Find window given position, search front-to-back
 // FIXME: Note that we have an inconsequential lag here: OuterRectClipped is updated in Begin(), so windows moved programatically
 // with SetWindowPos() and not SetNextWindowPos() will have that rectangle lagging by a frame at the time FindHoveredWindow() is
@@ -3974,23 +4908,20 @@ static void FindHoveredWindow()
     if (g.MovingWindow && !(g.MovingWindow->Flags & ImGuiWindowFlags_NoMouseInputs))
         hovered_window = g.MovingWindow;
 
-    ImVec2 padding_regular = g.Style.TouchExtraPadding;
-    ImVec2 padding_for_resize_from_edges = g.IO.ConfigWindowsResizeFromEdges ? ImMax(g.Style.TouchExtraPadding, ImVec2(WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS, WINDOWS_RESIZE_FROM_EDGES_HALF_THICKNESS)) : padding_regular;
+    // Use the grid built by the last EndFrame(), unless the windows order changed since
+    if (hovered_window == NULL && g.WindowsHitGrid.FrameCount == g.FrameCount - 1)
+    {
+        g.HoveredWindow = g.WindowsHitGrid.FindWindow(g.IO.MousePos);
+        g.HoveredRootWindow = g.HoveredWindow ? g.HoveredWindow->RootWindow : NULL;
+        return;
+    }
+
     for (int i = g.Windows.Size - 1; i >= 0; i--)
     {
         ImGuiWindow* window = g.Windows[i];
-        if (!window->Active || window->Hidden)
+        if (!IsWindowHoverable(window))
             continue;
-        if (window->Flags & ImGuiWindowFlags_NoMouseInputs)
-            continue;
-
-        // Using the clipped AABB, a child window will typically be clipped by its parent (not always)
-        ImRect bb(window->OuterRectClipped);
-        if ((window->Flags & ImGuiWindowFlags_ChildWindow) || (window->Flags & ImGuiWindowFlags_NoResize))
-            bb.Expand(padding_regular);
-        else
-            bb.Expand(padding_for_resize_from_edges);
-        if (!bb.Contains(g.IO.MousePos))
+        if (!GetWindowHitRect(window).Contains(g.IO.MousePos))
             continue;
 
         // Those seemingly unnecessary extra tests are because the code here is a little different in viewport/docking branches.
@@ -4643,6 +5574,25 @@ static ImGuiCol GetWindowBgColorIdxFromFlags(ImGuiWindowFlags flags)
     return ImGuiCol_WindowBg;
 }
 
+// Can the window be hidden because occluded (io.ConfigWindowsOcclusionCulling)
+// Exclude windows which are not a stable background: appearing or auto-resizing, interacted with, or hosting popups/menus
+static bool IsWindowOcclusionCullable(ImGuiWindow* window)
+{
+    ImGuiContext& g = *GImGui;
+    if (window->Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Tooltip | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Modal | ImGuiWindowFlags_AlwaysAutoResize))
+        return false;
+    if (window->Appearing || window->AutoFitFramesX > 0 || window->AutoFitFramesY > 0 || window->HiddenFramesForResize > 0)
+        return false;
+    if ((g.NavWindow && g.NavWindow->RootWindow == window) || (g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == window))
+        return false;
+    if ((g.MovingWindow && g.MovingWindow->RootWindow == window) || (g.NavWindowingTarget && g.NavWindowingTarget->RootWindow == window))
+        return false;
+    for (int n = 0; n < g.OpenPopupStack.Size; n++)
+        if (g.OpenPopupStack[n].ParentWindow && g.OpenPopupStack[n].ParentWindow->RootWindow == window)
+            return false;
+    return true;
+}
+
 static void CalcResizePosSizeFromAnyCorner(ImGuiWindow* window, const ImVec2& corner_target, const ImVec2& corner_norm, ImVec2* out_pos, ImVec2* out_size)
 {
     ImVec2 pos_min = ImLerp(corner_target, window->Pos, corner_norm);                // Expected window upper-left
@@ -5179,9 +6129,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // DRAWING
 
         // Setup draw list and outer clipping rectangle
+        if (!window->Hidden)
+            window->OccludedVtxCount = window->DrawList->VtxBuffer.Size;
         window->DrawList->Clear();
+        window->DrawListJobs.resize(0);
         window->DrawList->Flags = (g.Style.AntiAliasedLines ? ImDrawListFlags_AntiAliasedLines : 0) | (g.Style.AntiAliasedFill ? ImDrawListFlags_AntiAliasedFill : 0);
-        window->DrawList->PushTextureID(g.Font->ContainerAtlas->TexID);
+        if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
+            window->DrawList->Flags |= ImDrawListFlags_AllowVtxOffset;
+        window->DrawList->PushTextureID(g.Font->GetTexID());
         ImRect viewport_rect(GetViewportRect());
         if ((flags & ImGuiWindowFlags_ChildWindow) && !(flags & ImGuiWindowFlags_Popup) && !window_is_child_tooltip)
             PushClipRect(parent_window->ClipRect.Min, parent_window->ClipRect.Max, true);
@@ -5213,6 +6168,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         const ImGuiWindow* window_to_highlight = g.NavWindowingTarget ? g.NavWindowingTarget : g.NavWindow;
         const bool title_bar_is_highlight = want_focus || (window_to_highlight && window->RootWindowForTitleBarHighlight == window_to_highlight->RootWindowForTitleBarHighlight);
         const ImRect title_bar_rect = window->TitleBarRect();
+        bool window_is_opaque = false; // Background, title bar and menu bar all fully opaque: windows behind can be occluded
         if (window->Collapsed)
         {
             // Title bar only
@@ -5234,6 +6190,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
                 if (alpha != 1.0f)
                     bg_col = (bg_col & ~IM_COL32_A_MASK) | (IM_F32_TO_INT8_SAT(alpha) << IM_COL32_A_SHIFT);
                 window->DrawList->AddRectFilled(window->Pos + ImVec2(0, window->TitleBarHeight()), window->Pos + window->Size, bg_col, window_rounding, (flags & ImGuiWindowFlags_NoTitleBar) ? ImDrawCornerFlags_All : ImDrawCornerFlags_Bot);
+                window_is_opaque = (bg_col & IM_COL32_A_MASK) == IM_COL32_A_MASK;
             }
             g.NextWindowData.BgAlphaCond = 0;
 
@@ -5242,6 +6199,7 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             {
                 ImU32 title_bar_col = GetColorU32(title_bar_is_highlight ? ImGuiCol_TitleBgActive : ImGuiCol_TitleBg);
                 window->DrawList->AddRectFilled(title_bar_rect.Min, title_bar_rect.Max, title_bar_col, window_rounding, ImDrawCornerFlags_Top);
+                window_is_opaque &= (title_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK;
             }
 
             // Menu bar
@@ -5249,7 +6207,9 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
             {
                 ImRect menu_bar_rect = window->MenuBarRect();
                 menu_bar_rect.ClipWith(window->Rect());  // Soft clipping, in particular child window don't have minimum size covering the menu bar so this is useful for them.
-                window->DrawList->AddRectFilled(menu_bar_rect.Min, menu_bar_rect.Max, GetColorU32(ImGuiCol_MenuBarBg), (flags & ImGuiWindowFlags_NoTitleBar) ? window_rounding : 0.0f, ImDrawCornerFlags_Top);
+                ImU32 menu_bar_col = GetColorU32(ImGuiCol_MenuBarBg);
+                window->DrawList->AddRectFilled(menu_bar_rect.Min, menu_bar_rect.Max, menu_bar_col, (flags & ImGuiWindowFlags_NoTitleBar) ? window_rounding : 0.0f, ImDrawCornerFlags_Top);
+                window_is_opaque &= (menu_bar_col & IM_COL32_A_MASK) == IM_COL32_A_MASK;
                 if (style.FrameBorderSize > 0.0f && menu_bar_rect.Max.y < window->Pos.y + window->Size.y)
                     window->DrawList->AddLine(menu_bar_rect.GetBL(), menu_bar_rect.GetBR(), GetColorU32(ImGuiCol_Border), style.FrameBorderSize);
             }
@@ -5406,6 +6366,13 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         // Save clipped aabb so we can access it in constant-time in FindHoveredWindow()
         window->OuterRectClipped = window->Rect();
         window->OuterRectClipped.ClipWith(window->ClipRect);
+        window->OccludingRect = ImRect();
+        if (window_is_opaque)
+        {
+            // Stay away from the rounded corners
+            window->OccludingRect = window->OuterRectClipped;
+            window->OccludingRect.Expand(-window_rounding);
+        }
 
         // Pressing CTRL+C while holding on a window copy its content to the clipboard
         // This works but 1. doesn't handle multiple Begin/End pairs, 2. recursing into another Begin/End pair - so we need to work that out and add better logging scope.
@@ -5466,8 +6433,26 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
     if (style.Alpha <= 0.0f)
         window->HiddenFramesRegular = 1;
 
+    // Hide windows fully covered by an opaque window in front of them on the last frame (io.ConfigWindowsOcclusionCulling)
+    if (first_begin_of_the_frame)
+    {
+        window->Occluded = false;
+        if (g.IO.ConfigWindowsOcclusionCulling && window->HiddenFramesRegular == 0 && IsWindowOcclusionCullable(window) && g.WindowsHitGrid.IsWindowOccluded(window, window->OuterRectClipped))
+        {
+            window->HiddenFramesRegular = 1;
+            window->Occluded = true;
+            window->OccludedFrames++;
+            g.WindowsOccludedCount++;
+            g.WindowsOccludedVtxCount += window->OccludedVtxCount;
+            g.WindowsOccludedFramesTotal++;
+            g.WindowsOccludedVtxTotal += (ImU64)window->OccludedVtxCount;
+        }
+    }
+
     // Update the Hidden flag
     window->Hidden = (window->HiddenFramesRegular > 0) || (window->HiddenFramesForResize > 0);
+    if (window->Hidden)
+        window->OccludingRect = ImRect();
 
     // Return false if we don't intend to display anything to allow user to perform an early out optimization
     window->SkipItems = (window->Collapsed || !window->Active || window->Hidden) && window->AutoFitFramesX <= 0 && window->AutoFitFramesY <= 0 && window->HiddenFramesForResize <= 0;
@@ -5540,6 +6525,7 @@ void ImGui::BringWindowToDisplayFront(ImGuiWindow* window)
     ImGuiWindow* current_front_window = g.Windows.back();
     if (current_front_window == window || current_front_window->RootWindow == window)
         return;
+    g.WindowsHitGrid.FrameCount = -1; // Display order changed
     for (int i = g.Windows.Size - 2; i >= 0; i--) // We can ignore the front most window
         if (g.Windows[i] == window)
         {
@@ -5554,6 +6540,7 @@ void ImGui::BringWindowToDisplayBack(ImGuiWindow* window)
     ImGuiContext& g = *GImGui;
     if (g.Windows[0] == window)
         return;
+    g.WindowsHitGrid.FrameCount = -1; // Display order changed
     for (int i = 0; i < g.Windows.Size; i++)
         if (g.Windows[i] == window)
         {
@@ -5680,7 +6667,7 @@ void ImGui::PushFont(ImFont* font)
         font = GetDefaultFont();
     SetCurrentFont(font);
     g.FontStack.push_back(font);
-    g.CurrentWindow->DrawList->PushTextureID(font->ContainerAtlas->TexID);
+    g.CurrentWindow->DrawList->PushTextureID(font->GetTexID());
 }
 
 void  ImGui::PopFont()
@@ -7165,6 +8152,32 @@ static bool NavScoreItem(ImGuiNavMoveResult* result, ImRect cand)
         cand.ClipWithFull(window->ClipRect); // This allows the scored item to not overlap other candidates in the parent window
     }
 
+    // Early out for items which can't become the best candidate, so scoring windows with many items stays cheap. This is only valid when no axial match can be
+    // recorded (see below) and gives the same result as the full scoring otherwise. An item on the wrong side of 'curr' on the movement axis can't be in the quadrant
+    // we are moving to. Those tests run before the clamping below, which is only valid when it affects the other axis: NavMoveClipDir is on the same axis as
+    // NavMoveDir, except when NavMoveRequestTryWrapping() pairs them for ImGuiNavMoveFlags_WrapX/WrapY, in which case we use the full scoring.
+#if !IMGUI_DEBUG_NAV_SCORING
+    const bool move_and_clip_same_axis = ((g.NavMoveDir == ImGuiDir_Left || g.NavMoveDir == ImGuiDir_Right) == (g.NavMoveClipDir == ImGuiDir_Left || g.NavMoveClipDir == ImGuiDir_Right));
+    const bool early_out = move_and_clip_same_axis && !(g.NavLayer == 1 && !(g.NavWindow->Flags & ImGuiWindowFlags_ChildMenu));
+    if (early_out)
+    {
+        if (g.NavMoveDir == ImGuiDir_Left || g.NavMoveDir == ImGuiDir_Right)
+        {
+            const float d_axis = NavScoreItemDistInterval(cand.Min.x, cand.Max.x, curr.Min.x, curr.Max.x);
+            if ((g.NavMoveDir == ImGuiDir_Left) ? (d_axis > 0.0f) : (d_axis < 0.0f))
+                return false;
+        }
+        else
+        {
+            const float d_axis = NavScoreItemDistInterval(ImLerp(cand.Min.y, cand.Max.y, 0.2f), ImLerp(cand.Min.y, cand.Max.y, 0.8f), ImLerp(curr.Min.y, curr.Max.y, 0.2f), ImLerp(curr.Min.y, curr.Max.y, 0.8f));
+            if ((g.NavMoveDir == ImGuiDir_Up) ? (d_axis > 0.0f) : (d_axis < 0.0f))
+                return false;
+            if (ImFabs(d_axis) > result->DistBox) // dist_box >= |dby|
+                return false;
+        }
+    }
+#endif
+
     // We perform scoring on items bounding box clipped by the current clipping rectangle on the other axis (clipping on our movement axis would give us equal scores for all clipped items)
     // For example, this ensure that items in one column are not reached when moving vertically from items in another column.
     NavClampRectToVisibleAreaForMoveDir(g.NavMoveClipDir, cand, window->ClipRect);
@@ -7176,6 +8189,10 @@ static bool NavScoreItem(ImGuiNavMoveResult* result, ImRect cand)
     if (dby != 0.0f && dbx != 0.0f)
        dbx = (dbx/1000.0f) + ((dbx > 0.0f) ? +1.0f : -1.0f);
     float dist_box = ImFabs(dbx) + ImFabs(dby);
+#if !IMGUI_DEBUG_NAV_SCORING
+    if (early_out && dist_box > result->DistBox) // Farther than the current best candidate: can't beat it or tie with it
+        return false;
+#endif
 
     // Compute distance between centers (this is off by a factor of 2, but we only compare center distances with each other so it doesn't matter)
     float dcx = (cand.Min.x + cand.Max.x) - (curr.Min.x + curr.Max.x);
@@ -9276,12 +10293,22 @@ void ImGui::ShowMetricsWindow(bool* p_open)
 
     static bool show_draw_cmd_clip_rects = true;
     static bool show_window_begin_order = false;
-    ImGuiIO& io = ImGui::GetIO();
+    ImGuiContext& g = *GImGui; // Access private state
+    ImGuiIO& io = g.IO;
     ImGui::Text("Dear ImGui %s", ImGui::GetVersion());
     ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
     ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
     ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
     ImGui::Text("%d allocations", io.MetricsActiveAllocations);
+    ImGui::Text("Last frame: %d heap allocations (%d bytes), %d frame allocations (%d bytes)", g.FrameHeapAllocCountPrev, g.FrameHeapAllocBytesPrev, g.FrameArenaAllocCountPrev, g.FrameArenaAllocBytesPrev);
+    if (g.FrameAllocFunc == NULL)
+        ImGui::Text("Frame arena: %d bytes in %d blocks", g.FrameArena.GetCapacity(), g.FrameArena.Blocks.Size);
+    if (g.DrawListSharedData.GlyphRunCache)
+        ImGui::Text("Glyph-run cache: %d hits, %d misses, %d runs, %d quads, %d bytes", g.GlyphRunCache.HitCountPrev, g.GlyphRunCache.MissCountPrev, g.GlyphRunCache.Runs.Size, g.GlyphRunCache.Quads.Size, g.GlyphRunCache.GetMemoryUsage());
+    if (io.ConfigWindowsOcclusionCulling)
+        ImGui::Text("Occlusion culling: %d windows (%d vertices) last frame, %d window-frames (%llu vertices) total", g.WindowsOccludedCountPrev, g.WindowsOccludedVtxCountPrev, g.WindowsOccludedFramesTotal, (unsigned long long)g.WindowsOccludedVtxTotal);
+    if (g.DrawListSharedData.WrapLayoutCache)
+        ImGui::Text("Wrap layout cache: %d hits, %d misses, %d layouts, %d lines, %d bytes", g.WrapLayoutCache.HitCountPrev, g.WrapLayoutCache.MissCountPrev, g.WrapLayoutCache.Layouts.Size, g.WrapLayoutCache.Lines.Size, g.WrapLayoutCache.GetMemoryUsage());
     ImGui::Checkbox("Show clipping rectangles when hovering draw commands", &show_draw_cmd_clip_rects);
     ImGui::Checkbox("Ctrl shows window begin order", &show_window_begin_order);
     ImGui::Separator();
@@ -9305,6 +10332,12 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             if (!node_open)
                 return;
 
+            for (int stats_n = 0; stats_n < draw_list->_TextStats.Size; stats_n++)
+            {
+                const ImDrawTextStats& stats = draw_list->_TextStats[stats_n];
+                ImGui::BulletText("Text with font '%s': %d texts, %d glyphs, %d clipped glyphs, %d vtx", stats.Font->GetDebugName(), stats.TextCount, stats.GlyphCount, stats.GlyphClippedCount, stats.VtxCount);
+            }
+
             int elem_offset = 0;
             for (const ImDrawCmd* pcmd = draw_list->CmdBuffer.begin(); pcmd < draw_list->CmdBuffer.end(); elem_offset += pcmd->ElemCount, pcmd++)
             {
@@ -9316,13 +10349,13 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                     continue;
                 }
                 ImDrawIdx* idx_buffer = (draw_list->IdxBuffer.Size > 0) ? draw_list->IdxBuffer.Data : NULL;
-                bool pcmd_node_open = ImGui::TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "Draw %4d %s vtx, tex 0x%p, clip_rect (%4.0f,%4.0f)-(%4.0f,%4.0f)", pcmd->ElemCount, draw_list->IdxBuffer.Size > 0 ? "indexed" : "non-indexed", pcmd->TextureId, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
+                bool pcmd_node_open = ImGui::TreeNode((void*)(pcmd - draw_list->CmdBuffer.begin()), "Draw %4d %s vtx, vtx_offset %d, tex 0x%p, clip_rect (%4.0f,%4.0f)-(%4.0f,%4.0f)", pcmd->ElemCount, draw_list->IdxBuffer.Size > 0 ? "indexed" : "non-indexed", pcmd->VtxOffset, pcmd->TextureId, pcmd->ClipRect.x, pcmd->ClipRect.y, pcmd->ClipRect.z, pcmd->ClipRect.w);
                 if (show_draw_cmd_clip_rects && ImGui::IsItemHovered())
                 {
                     ImRect clip_rect = pcmd->ClipRect;
                     ImRect vtxs_rect;
                     for (int i = elem_offset; i < elem_offset + (int)pcmd->ElemCount; i++)
-                        vtxs_rect.Add(draw_list->VtxBuffer[idx_buffer ? idx_buffer[i] : i].pos);
+                        vtxs_rect.Add(draw_list->VtxBuffer[idx_buffer ? pcmd->VtxOffset + idx_buffer[i] : i].pos);
                     clip_rect.Floor(); overlay_draw_list->AddRect(clip_rect.Min, clip_rect.Max, IM_COL32(255,255,0,255));
                     vtxs_rect.Floor(); overlay_draw_list->AddRect(vtxs_rect.Min, vtxs_rect.Max, IM_COL32(255,0,255,255));
                 }
@@ -9339,7 +10372,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                         ImVec2 triangles_pos[3];
                         for (int n = 0; n < 3; n++, vtx_i++)
                         {
-                            ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? idx_buffer[vtx_i] : vtx_i];
+                            ImDrawVert& v = draw_list->VtxBuffer[idx_buffer ? pcmd->VtxOffset + idx_buffer[vtx_i] : vtx_i];
                             triangles_pos[n] = v.pos;
                             buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n", (n == 0) ? "vtx" : "   ", vtx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
                         }
@@ -9372,6 +10405,8 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 return;
             ImGuiWindowFlags flags = window->Flags;
             NodeDrawList(window, window->DrawList, "DrawList");
+            for (int i = 0; i < window->DrawListJobs.Size; i++)
+                NodeDrawList(window, &window->DrawListJobs[i]->DrawList, "DrawListJob");
             ImGui::BulletText("Pos: (%.1f,%.1f), Size: (%.1f,%.1f), SizeContents (%.1f,%.1f)", window->Pos.x, window->Pos.y, window->Size.x, window->Size.y, window->SizeContents.x, window->SizeContents.y);
             ImGui::BulletText("Flags: 0x%08X (%s%s%s%s%s%s%s%s%s..)", flags,
                 (flags & ImGuiWindowFlags_ChildWindow)  ? "Child " : "",      (flags & ImGuiWindowFlags_Tooltip)     ? "Tooltip "   : "",  (flags & ImGuiWindowFlags_Popup) ? "Popup " : "",
@@ -9380,6 +10415,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             ImGui::BulletText("Scroll: (%.2f/%.2f,%.2f/%.2f)", window->Scroll.x, GetWindowScrollMaxX(window), window->Scroll.y, GetWindowScrollMaxY(window));
             ImGui::BulletText("Active: %d/%d, WriteAccessed: %d, BeginOrderWithinContext: %d", window->Active, window->WasActive, window->WriteAccessed, (window->Active || window->WasActive) ? window->BeginOrderWithinContext : -1);
             ImGui::BulletText("Appearing: %d, Hidden: %d (Reg %d Resize %d), SkipItems: %d", window->Appearing, window->Hidden, window->HiddenFramesRegular, window->HiddenFramesForResize, window->SkipItems);
+            ImGui::BulletText("Occluded: %d (%d frames, %d vertices saved per frame)", window->Occluded, window->OccludedFrames, window->OccludedVtxCount);
             ImGui::BulletText("NavLastIds: 0x%08X,0x%08X, NavLayerActiveMask: %X", window->NavLastIds[0], window->NavLastIds[1], window->DC.NavLayerActiveMask);
             ImGui::BulletText("NavLastChildNavWindow: %s", window->NavLastChildNavWindow ? window->NavLastChildNavWindow->Name : "NULL");
             if (!window->NavRectRel[0].IsInverted())
@@ -9404,7 +10440,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
                 }
                 ImGui::TreePop();
             }
-            ImGui::BulletText("Storage: %d bytes", window->StateStorage.Data.Size * (int)sizeof(ImGuiStorage::Pair));
+            ImGui::BulletText("Storage: %d bytes%s", window->StateStorage.Data.Size * (int)sizeof(ImGuiStorage::Pair) + window->StateStorage.HashIndex.Size * (int)sizeof(int), window->StateStorage.HashIndex.Size > 0 ? " (hashed)" : "");
             ImGui::TreePop();
         }
 
@@ -9431,8 +10467,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         }
     };
 
-    // Access private state, we are going to display the draw lists from last frame
-    ImGuiContext& g = *GImGui;
+    // We are going to display the draw lists from last frame
     Funcs::NodeWindows(g.Windows, "Windows");
     if (ImGui::TreeNode("DrawList", "Active DrawLists (%d)", g.DrawDataBuilder.Layers[0].Size))
     {
@@ -9440,6 +10475,27 @@ void ImGui::ShowMetricsWindow(bool* p_open)
             Funcs::NodeDrawList(NULL, g.DrawDataBuilder.Layers[0][i], "DrawList");
         ImGui::TreePop();
     }
+    ImDrawTextStats text_stats;
+    for (int font_n = 0; font_n < io.Fonts->Fonts.Size; font_n++)
+        text_stats.Add(io.Fonts->Fonts[font_n]->MetricsText);
+    if (ImGui::TreeNode("Text", "Text (%d glyphs, %d clipped glyphs, %d vtx)", text_stats.GlyphCount, text_stats.GlyphClippedCount, text_stats.VtxCount))
+    {
+        // Fonts: last frame. Draw lists: since they were last cleared, like the "DrawList" nodes above.
+        for (int font_n = 0; font_n < io.Fonts->Fonts.Size; font_n++)
+        {
+            const ImFont* font = io.Fonts->Fonts[font_n];
+            ImGui::BulletText("Font '%s' %.2f px: %d texts, %d glyphs, %d clipped glyphs, %d vtx", font->GetDebugName(), font->FontSize, font->MetricsText.TextCount, font->MetricsText.GlyphCount, font->MetricsText.GlyphClippedCount, font->MetricsText.VtxCount);
+        }
+        for (int i = 0; i < g.DrawDataBuilder.Layers[0].Size; i++)
+        {
+            const ImDrawList* draw_list = g.DrawDataBuilder.Layers[0][i];
+            if (draw_list->_TextStats.Size == 0)
+                continue;
+            ImDrawTextStats stats = draw_list->GetTextStats();
+            ImGui::BulletText("DrawList '%s': %d texts, %d glyphs, %d clipped glyphs, %d vtx", draw_list->_OwnerName ? draw_list->_OwnerName : "", stats.TextCount, stats.GlyphCount, stats.GlyphClippedCount, stats.VtxCount);
+        }
+        ImGui::TreePop();
+    }
     if (ImGui::TreeNode("Popups", "Popups (%d)", g.OpenPopupStack.Size))
     {
         for (int i = 0; i < g.OpenPopupStack.Size; i++)
@@ -9460,6 +10516,7 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         const char* input_source_names[] = { "None", "Mouse", "Nav", "NavKeyboard", "NavGamepad" }; IM_ASSERT(IM_ARRAYSIZE(input_source_names) == ImGuiInputSource_COUNT);
         ImGui::Text("HoveredWindow: '%s'", g.HoveredWindow ? g.HoveredWindow->Name : "NULL");
         ImGui::Text("HoveredRootWindow: '%s'", g.HoveredRootWindow ? g.HoveredRootWindow->Name : "NULL");
+        ImGui::Text("WindowsHitGrid: %d windows, %dx%d cells, %d cell entries", g.WindowsHitGrid.Entries.Size, g.WindowsHitGrid.CellsX, g.WindowsHitGrid.CellsY, g.WindowsHitGrid.CellsEntries.Size);
         ImGui::Text("HoveredId: 0x%08X/0x%08X (%.2f sec), AllowOverlap: %d", g.HoveredId, g.HoveredIdPreviousFrame, g.HoveredIdTimer, g.HoveredIdAllowOverlap); // Data is "in-flight" so depending on when the Metrics window is called we may see current frame information or not
         ImGui::Text("ActiveId: 0x%08X/0x%08X (%.2f sec), AllowOverlap: %d, Source: %s", g.ActiveId, g.ActiveIdPreviousFrame, g.ActiveIdTimer, g.ActiveIdAllowOverlap, input_source_names[g.ActiveIdSource]);
         ImGui::Text("ActiveIdWindow: '%s'", g.ActiveIdWindow ? g.ActiveIdWindow->Name : "NULL");
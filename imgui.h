@@ -18,8 +18,8 @@ Index of this file:
 // ImGuiIO
 // Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // Obsolete functions
-// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImColor)
-// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListFlags, ImDrawList, ImDrawData)
+// Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, ImGuiListClipperHeights, ImGuiPlotPyramid, ImColor)
+// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawCachedBlock, ImDrawListFlags, ImDrawList, ImDrawData)
 // Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 
 */
@@ -90,24 +90,31 @@ Index of this file:
 // Forward declarations and basic types
 //-----------------------------------------------------------------------------
 
+struct ImDrawCachedBlock;           // Recorded copy of a range of ImDrawList output, which can be replayed into any ImDrawList without re-tessellation
 struct ImDrawChannel;               // Temporary storage for ImDrawList ot output draw commands out of order, used by ImDrawList::ChannelsSplit()
 struct ImDrawCmd;                   // A single draw command within a parent ImDrawList (generally maps to 1 GPU draw call, unless it is a callback)
 struct ImDrawData;                  // All draw command lists required to render the frame + pos/size coordinates to use for the projection matrix.
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
+struct ImDrawListJob;               // Deferred filling of an ImDrawList, which may run on a worker thread (opaque structure, unless including imgui_internal.h)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
+struct ImFontAtlasDynamicGlyphs;    // State of ImFontAtlasFlags_DynamicGlyphs (opaque structure, private to imgui_draw.cpp)
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontWrapGlyph;             // A character position within a line of word-wrapped text, output by ImFont::CalcWordWrapLayoutA()
+struct ImFontWrapLine;              // A line of word-wrapped text, output by ImFont::CalcWordWrapLayoutA()
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store the heights of the items of a list for ImGuiListClipper, when they are not evenly spaced
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame, used by IMGUI_ONCE_UPON_A_FRAME macro
 struct ImGuiPayload;                // User data payload for drag and drop operations
+struct ImGuiPlotPyramid;            // Helper to plot huge series of samples with PlotLines()/PlotHistogram() using a min/max pyramid
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage
 struct ImGuiStyle;                  // Runtime data for styling/colors
@@ -120,7 +127,13 @@ struct ImGuiTextFilter;             // Helper to parse and apply text filters (e
 typedef void* ImTextureID;          // User data to identify a texture (this is whatever to you want it to be! read the FAQ about ImTextureID in imgui.cpp)
 #endif
 typedef unsigned int ImGuiID;       // Unique ID used by widgets (typically hashed from a stack of string)
+#ifdef IMGUI_USE_WCHAR32
+typedef unsigned int ImWchar;       // A single U32 character for keyboard input/display. We encode them as multi bytes UTF-8 when used in strings.
+#define IM_UNICODE_CODEPOINT_MAX    0x10FFFF    // Maximum Unicode code point supported by this build
+#else
 typedef unsigned short ImWchar;     // A single U16 character for keyboard input/display. We encode them as multi bytes UTF-8 when used in strings.
+#define IM_UNICODE_CODEPOINT_MAX    0xFFFF      // Maximum Unicode code point supported by this build (define IMGUI_USE_WCHAR32 in imconfig.h for U+10FFFF)
+#endif
 typedef int ImGuiCol;               // -> enum ImGuiCol_             // Enum: A color identifier for styling
 typedef int ImGuiCond;              // -> enum ImGuiCond_            // Enum: A condition for Set*()
 typedef int ImGuiDataType;          // -> enum ImGuiDataType_        // Enum: A primary data type
@@ -148,6 +161,7 @@ typedef int ImGuiTreeNodeFlags;     // -> enum ImGuiTreeNodeFlags_   // Flags: f
 typedef int ImGuiWindowFlags;       // -> enum ImGuiWindowFlags_     // Flags: for Begin*()
 typedef int (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData *data);
 typedef void (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);
+typedef void (*ImDrawListJobCallback)(ImDrawList* draw_list, void* user_data);
 
 // Scalar data types
 typedef signed int          ImS32;  // 32-bit signed integer == int
@@ -507,6 +521,8 @@ namespace ImGui
     IMGUI_API void          PlotLines(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
     IMGUI_API void          PlotHistogram(const char* label, const float* values, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0), int stride = sizeof(float));
     IMGUI_API void          PlotHistogram(const char* label, float(*values_getter)(void* data, int idx), void* data, int values_count, int values_offset = 0, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));
+    IMGUI_API void          PlotLines(const char* label, const ImGuiPlotPyramid* values, int values_offset = 0, int values_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));      // plot samples [values_offset, values_offset+values_count) in O(graph width), as a min/max envelope when there are more samples than pixels. values_count = -1: up to the last sample.
+    IMGUI_API void          PlotHistogram(const char* label, const ImGuiPlotPyramid* values, int values_offset = 0, int values_count = -1, const char* overlay_text = NULL, float scale_min = FLT_MAX, float scale_max = FLT_MAX, ImVec2 graph_size = ImVec2(0, 0));  // "
 
     // Widgets: Value() Helpers.
     // - Those are merely shortcut to calling Text() with a format string. Output single value in "name: value" format (tip: freely declare more in your code to handle your types. you can add functions to the ImGui namespace)
@@ -624,6 +640,8 @@ namespace ImGui
     IMGUI_API int           GetFrameCount();                                                    // get global imgui frame count. incremented by 1 every frame.
     IMGUI_API ImDrawList*   GetOverlayDrawList();                                               // this draw list will be the last rendered one, useful to quickly draw overlays shapes/text
     IMGUI_API ImDrawListSharedData* GetDrawListSharedData();                                    // you may use this when creating your own ImDrawList instances
+    IMGUI_API void          AddDrawListJob(ImDrawListJobCallback callback, void* user_data);     // [BETA] defer filling a draw list to Render(), possibly on a worker thread (see io.DrawListJobsDispatchFn). Output is rendered over the current window contents, under its child windows.
+    IMGUI_API void          RunDrawListJob(ImDrawListJob* job);                                 // [BETA] run a job passed to io.DrawListJobsDispatchFn. Thread-safe: may be called from any thread while Render() waits for io.DrawListJobsDispatchFn to return.
     IMGUI_API const char*   GetStyleColorName(ImGuiCol idx);
     IMGUI_API void          SetStateStorage(ImGuiStorage* storage);                             // replace current window storage with our own (if you want to manipulate it yourself, typically clear subsection of it)
     IMGUI_API ImGuiStorage* GetStateStorage();
@@ -674,11 +692,14 @@ namespace ImGui
     IMGUI_API const char*   SaveIniSettingsToMemory(size_t* out_ini_size = NULL);               // return a zero-terminated string with the .ini data which you can save by your own mean. call when io.WantSaveIniSettings is set, then save data by your own mean and clear io.WantSaveIniSettings.
 
     // Memory Utilities
-    // - All those functions are not reliant on the current context.
+    // - All those functions are not reliant on the current context, except MemAllocFrame() and SetFrameAllocatorFunctions().
     // - If you reload the contents of imgui.cpp at runtime, you may need to call SetCurrentContext() + SetAllocatorFunctions() again.
     IMGUI_API void          SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);
+    IMGUI_API void          GetAllocatorFunctions(void* (**p_alloc_func)(size_t sz, void* user_data), void (**p_free_func)(void* ptr, void* user_data), void** p_user_data);
     IMGUI_API void*         MemAlloc(size_t size);
     IMGUI_API void          MemFree(void* ptr);
+    IMGUI_API void*         MemAllocFrame(size_t size);                                         // allocate transient memory from the current context frame arena. valid until the next NewFrame(), never free it. not thread-safe.
+    IMGUI_API void          SetFrameAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*reset_func)(void* user_data), void* user_data = NULL); // replace the current context frame arena with your own linear allocator. reset_func is called by NewFrame(). pass NULL to restore the default arena.
 
 } // namespace ImGui
 
@@ -984,10 +1005,12 @@ enum ImGuiConfigFlags_
 // Back-end capabilities flags stored in io.BackendFlags. Set by imgui_impl_xxx or custom back-end.
 enum ImGuiBackendFlags_
 {
-    ImGuiBackendFlags_None                  = 0,
-    ImGuiBackendFlags_HasGamepad            = 1 << 0,   // Back-end supports gamepad and currently has one connected.
-    ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Back-end supports honoring GetMouseCursor() value to change the OS cursor shape.
-    ImGuiBackendFlags_HasSetMousePos        = 1 << 2    // Back-end supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
+    ImGuiBackendFlags_None                   = 0,
+    ImGuiBackendFlags_HasGamepad             = 1 << 0,   // Back-end supports gamepad and currently has one connected.
+    ImGuiBackendFlags_HasMouseCursors        = 1 << 1,   // Back-end supports honoring GetMouseCursor() value to change the OS cursor shape.
+    ImGuiBackendFlags_HasSetMousePos         = 1 << 2,   // Back-end supports io.WantSetMousePos requests to reposition the OS mouse position (only used if ImGuiConfigFlags_NavEnableSetMousePos is set).
+    ImGuiBackendFlags_RendererHasVtxOffset   = 1 << 3,   // Back-end renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bits indices.
+    ImGuiBackendFlags_RendererHasContentHash = 1 << 4    // Back-end renderer uses ImDrawList::ContentGeneration or ImDrawData::IsCmdListChanged() to skip uploading unchanged draw lists. This enables hashing draw lists contents in Render().
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -1307,6 +1330,10 @@ struct ImGuiIO
     bool        ConfigInputTextCursorBlink;     // = true           // Set to false to disable blinking cursor, for users who consider it distracting. (was called: io.OptCursorBlink prior to 1.63)
     bool        ConfigWindowsResizeFromEdges;   // = true           // Enable resizing of windows from their edges and from the lower-left corner. This requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback. (This used to be the a per-window ImGuiWindowFlags_ResizeFromAnySide flag)
     bool        ConfigWindowsMoveFromTitleBarOnly; // = false       // [BETA] Set to true to only allow moving windows when clicked+dragged from the title bar. Windows without a title bar are not affected.
+    bool        ConfigStorageUseHashMap;        // = false          // [BETA] Set to true to index ImGuiStorage instances (windows lookup, tree nodes states, etc.) with a hash table for O(1) queries and insertions. Costs extra memory. Storages switch on their next insertion.
+    bool        ConfigTextGlyphRunCache;        // = false          // [BETA] Set to true to cache the layout of text (glyph quads and measured size) across frames, so static labels are emitted by copying cached vertices. See Metrics window for hit/miss counters.
+    bool        ConfigTextWrapLayoutCache;      // = false          // [BETA] Set to true to cache line breaks of word-wrapped text across frames, so long wrapped paragraphs are not wrapped again every frame. On resize, only visible paragraphs are wrapped again.
+    bool        ConfigWindowsOcclusionCulling;  // = false          // [BETA] Set to true to hide windows which were fully covered by an opaque window in front of them on the previous frame: their Begin() returns false so their contents are not submitted. A window uncovered by a window which moved or closed may be missing for one frame. See Metrics window for counters.
 
     //------------------------------------------------------------------
     // Platform Functions
@@ -1331,6 +1358,16 @@ struct ImGuiIO
     void        (*ImeSetInputScreenPosFn)(int x, int y);
     void*       ImeWindowHandle;                // = NULL           // (Windows) Set this to your HWND to get automatic IME cursor positioning.
 
+    // Optional: Run jobs submitted with ImGui::AddDrawListJob() on your own worker threads. Called from Render(), must only return once every job has finished.
+    // Call ImGui::RunDrawListJob() once for each job, from any thread, in any order: the output order is fixed by submission order regardless.
+    // Thread-safety contract: job callbacks may only write to the ImDrawList they are given (and their own user data), may read fonts, but must not call any ImGui:: function.
+    // Fonts are read-only while jobs run: ImDrawList::AddText() draws glyphs not rasterized yet (ImFontAtlasFlags_DynamicGlyphs) with the fallback glyph, then Render() loads them on its own thread
+    // for the next frame. Don't call ImFont::FindGlyph()/FindGlyphNoFallback()/FindGlyphs() from a job on such an atlas, as they load missing glyphs.
+    // Draw list memory grows through ImGui::MemAlloc()/MemFree() (so your SetAllocatorFunctions() functions need to be thread-safe), which update the context allocation counters atomically.
+    // (default to NULL: jobs are run serially on the thread calling Render())
+    void        (*DrawListJobsDispatchFn)(ImDrawListJob** jobs, int jobs_count, void* user_data);
+    void*       DrawListJobsUserData;
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     // [OBSOLETE since 1.60+] Rendering function, will be automatically called in Render(). Please call your rendering function yourself now!
     // You can obtain the ImDrawData* by calling ImGui::GetDrawData() after Render(). See example applications if you are unsure of how to implement this.
@@ -1597,6 +1634,7 @@ struct ImGuiTextBuffer
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// When io.ConfigStorageUseHashMap is set, storages are also indexed by an open-addressing hash table (HashIndex) and Data is kept in insertion order instead.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -1612,11 +1650,12 @@ struct ImGuiStorage
         Pair(ImGuiID _key, void* _val_p) { key = _key; val_p = _val_p; }
     };
     ImVector<Pair>      Data;
+    ImVector<int>       HashIndex;      // Open-addressing table of indices into Data (-1 = empty slot). Empty unless hashed.
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N), or O(1) when hashed.
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
-    void                Clear() { Data.clear(); }
+    void                Clear() { Data.clear(); HashIndex.clear(); }
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -1640,6 +1679,9 @@ struct ImGuiStorage
 
     // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
     IMGUI_API void      BuildSortByKey();
+
+    // Index with a hash table now (this is otherwise done on insertion when io.ConfigStorageUseHashMap is set). Lasts until Clear().
+    IMGUI_API void      BuildHashIndex();
 };
 
 // Helper: Manually clip large list of items.
@@ -1655,23 +1697,77 @@ struct ImGuiStorage
 // - Step 1: the clipper infer height from first element, calculate the actual range of elements to display, and position the cursor before the first element.
 // - (Step 2: dummy step only required if an explicit items_height was passed to constructor or Begin() and user call Step(). Does nothing and switch to Step 3.)
 // - Step 3: the clipper validate that we have reached the expected Y position (corresponding to element DisplayEnd), advance the cursor to the end of the list and then returns 'false' to end the loop.
+// If your items are not evenly spaced, pass an ImGuiListClipperHeights instead of items_height, see below. This requires a known items_count (not INT_MAX).
 struct ImGuiListClipper
 {
     float   StartPosY;
     float   ItemsHeight;
     int     ItemsCount, StepNo, DisplayStart, DisplayEnd;
+    ImGuiListClipperHeights* ItemsHeights;  // Heights of variable height items (NULL when using ItemsHeight)
+    float   ItemPosY;                       // Cursor position before the item being displayed, when using ItemsHeights
 
     // items_count:  Use -1 to ignore (you can call Begin later). Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step).
     // items_height: Use -1.0f to be calculated automatically on first step. Otherwise pass in the distance between your items, typically GetTextLineHeightWithSpacing() or GetFrameHeightWithSpacing().
     // If you don't specify an items_height, you NEED to call Step(). If you specify items_height you may call the old Begin()/End() api directly, but prefer calling Step().
     ImGuiListClipper(int items_count = -1, float items_height = -1.0f)  { Begin(items_count, items_height); } // NB: Begin() initialize every fields (as we allow user to call Begin/End multiple times on a same instance if they want).
+    ImGuiListClipper(int items_count, ImGuiListClipperHeights* items_heights) { Begin(items_count, items_heights); }
     ~ImGuiListClipper()                                                 { IM_ASSERT(ItemsCount == -1); }      // Assert if user forgot to call End() or Step() until false.
 
     IMGUI_API bool Step();                                              // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
     IMGUI_API void Begin(int items_count, float items_height = -1.0f);  // Automatically called by constructor if you passed 'items_count' or by Step() in Step 1.
+    IMGUI_API void Begin(int items_count, ImGuiListClipperHeights* items_heights); // Automatically called by constructor if you passed 'items_heights'. You NEED to call Step().
     IMGUI_API void End();                                               // Automatically called on the last call of Step() that returns false.
 };
 
+// Helper: Heights of the items of a list which are not evenly spaced (e.g. wrapped text, tree nodes), to clip it with ImGuiListClipper.
+// Keep one instance per list alive across frames. The clipper learns the height of each item from the cursor movement when it is displayed,
+// items never displayed yet are assumed to be DefaultHeight high. The sums of heights are indexed with a Fenwick tree, so seeking to the
+// first visible item and updating the height of an item are O(log N): displaying a list of 1M items costs O(visible items).
+// Usage:
+//     static ImGuiListClipperHeights heights;
+//     ImGuiListClipper clipper(items_count, &heights);
+//     while (clipper.Step())                                          // Items are returned one by one so their height can be measured
+//         for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//             ImGui::TextWrapped("%s", items[i]);
+// If the height of an item changes while it is not visible, you may call SetHeight() yourself. If items are inserted or removed other than at
+// the end of the list, call Clear() so heights are learned again.
+struct ImGuiListClipperHeights
+{
+    ImVector<float>     Heights;            // Height of each item, including spacing (= cursor movement)
+    ImVector<double>    Sums;               // Fenwick tree: Sums[i-1] is the sum of Heights[i - (i & -i)] to Heights[i-1]
+    float               DefaultHeight;      // Height of the items which haven't been displayed yet. 0.0f: set to GetTextLineHeightWithSpacing() by ImGuiListClipper::Begin().
+
+    ImGuiListClipperHeights(float default_height = 0.0f)    { DefaultHeight = default_height; }
+    int                 Size() const                        { return Heights.Size; }
+    void                Clear()                             { Heights.clear(); Sums.clear(); }
+    float               GetTotalHeight() const              { return GetOffset(Heights.Size); }
+    IMGUI_API void      Resize(int items_count);            // Add (with DefaultHeight) or remove items at the end of the list.
+    IMGUI_API void      SetHeight(int item_idx, float height);  // O(log N)
+    IMGUI_API float     GetOffset(int item_idx) const;      // Sum of the heights of the items before 'item_idx'. O(log N)
+    IMGUI_API int       FindItem(float offset) const;       // Index of the item at 'offset' from the top of the list, Size() if past the end. O(log N)
+};
+
+// Helper: Min/max pyramid of a series of samples, to plot huge series (e.g. millions of samples of telemetry) with PlotLines()/PlotHistogram().
+// PlotLines()/PlotHistogram() on a plain array scan every value to find the scale, then only display one value per pixel, dropping peaks.
+// Usage:
+//     static ImGuiPlotPyramid samples;
+//     samples.AddSamples(new_values, new_values_count);   // Append samples as they come, O(new_values_count + log4(samples)) per call
+//     ImGui::PlotLines("Telemetry", &samples);             // Each column of pixels displays the min/max of the samples it covers, O(graph width * log(samples))
+// - Levels[0] stores the min/max of every 4 samples, Levels[1] of every 16 samples, etc. Memory usage is ~1.7x the one of the samples alone.
+// - Each append updates one entry per level: AddSample() costs O(log4(samples)) per sample, appending in bulk with AddSamples() brings it down to O(1) amortized.
+// - GetMinMax() returns the min/max of any range of samples in O(log(range size)), e.g. to compute your own scale.
+struct ImGuiPlotPyramid
+{
+    ImVector<float>     Samples;            // All samples
+    ImVector<ImVec2>    Levels[16];         // Levels[n][i] = (min,max) of Samples[i * 4^(n+1)] to Samples[(i+1) * 4^(n+1) - 1]. The last entry of each level covers the remaining samples.
+
+    int                 Size() const        { return Samples.Size; }
+    void                Clear()             { Samples.clear(); for (int n = 0; n < IM_ARRAYSIZE(Levels); n++) Levels[n].clear(); }
+    void                AddSample(float v)  { AddSamples(&v, 1); }
+    IMGUI_API void      AddSamples(const float* values, int values_count);
+    IMGUI_API ImVec2    GetMinMax(int idx_begin, int idx_end) const;    // Min (x) and max (y) of Samples[idx_begin] to Samples[idx_end-1]
+};
+
 // Helpers macros to generate 32-bits encoded colors
 #ifdef IMGUI_USE_BGRA_PACKED_COLOR
 #define IM_COL32_R_SHIFT    16
@@ -1713,7 +1809,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListFlags, ImDrawList, ImDrawData)
+// Draw List API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawCachedBlock, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
 //-----------------------------------------------------------------------------
 
@@ -1730,10 +1826,11 @@ struct ImDrawCmd
     unsigned int    ElemCount;              // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
     ImVec4          ClipRect;               // Clipping rectangle (x1, y1, x2, y2). Subtract ImDrawData->DisplayPos to get clipping rectangle in "viewport" coordinates
     ImTextureID     TextureId;              // User-provided texture ID. Set by user in ImfontAtlas::SetTexID() for fonts or passed to Image*() functions. Ignore if never using images or multiple fonts atlas.
+    unsigned int    VtxOffset;              // Start offset in vertex buffer. Indices of this command are relative to it. Always 0 unless the back-end sets ImGuiBackendFlags_RendererHasVtxOffset, in which case it needs to be added to the vertex offset of the draw call.
     ImDrawCallback  UserCallback;           // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;       // The draw callback code can access this.
 
-    ImDrawCmd() { ElemCount = 0; ClipRect.x = ClipRect.y = ClipRect.z = ClipRect.w = 0.0f; TextureId = (ImTextureID)NULL; UserCallback = NULL; UserCallbackData = NULL; }
+    ImDrawCmd() { ElemCount = 0; ClipRect.x = ClipRect.y = ClipRect.z = ClipRect.w = 0.0f; TextureId = (ImTextureID)NULL; VtxOffset = 0; UserCallback = NULL; UserCallbackData = NULL; }
 };
 
 // Vertex index (override with '#define ImDrawIdx unsigned int' in imconfig.h)
@@ -1765,6 +1862,41 @@ struct ImDrawChannel
     ImVector<ImDrawIdx>     IdxBuffer;
 };
 
+// Cached blocks are used to record static geometry once and replay it on following frames at the cost of a copy (no tessellation, no text layout).
+// Fill with ImDrawList::BeginCachedBlock()/EndCachedBlock(), replay with ImDrawList::AddCachedBlock(). The same block may be replayed into any ImDrawList.
+// Indices are stored relative to the first vertex of the block. Clipping rectangles and texture coordinates are stored as they were when recording (re-record after rebuilding the font atlas).
+struct ImDrawCachedBlock
+{
+    ImVector<ImDrawCmd>     CmdBuffer;          // Recorded commands (empty commands are stripped)
+    ImVector<ImDrawIdx>     IdxBuffer;          // Recorded indices, relative to VtxBuffer[0]
+    ImVector<ImDrawVert>    VtxBuffer;          // Recorded vertices
+
+    // [Internal, used while recording]
+    int                     _CmdStart;          // Index of the command which was current when recording started
+    int                     _IdxStart;          // IdxBuffer.Size when recording started
+    int                     _VtxStart;          // VtxBuffer.Size when recording started
+    int                     _Channel;           // Channel we are recording from (-1 when not recording)
+
+    ImDrawCachedBlock()     { _CmdStart = _IdxStart = _VtxStart = 0; _Channel = -1; }
+    bool    IsRecording() const                 { return _Channel != -1; }
+    void    Clear()                             { CmdBuffer.clear(); IdxBuffer.clear(); VtxBuffer.clear(); _Channel = -1; }
+};
+
+// Text rendering counters for one font, accumulated in each ImDrawList by ImFont::RenderText() since the last ImDrawList::Clear().
+// Use ImDrawList::GetTextStats() for a window, ImFont::MetricsText for the whole last frame. Also displayed in the Metrics window.
+struct ImDrawTextStats
+{
+    const ImFont*   Font;               // Font the counters are for (NULL when summed over all fonts)
+    int             TextCount;          // Number of texts rendered (ImDrawList::AddText() or ImFont::RenderText() calls)
+    int             GlyphCount;         // Number of glyphs output
+    int             GlyphClippedCount;  // Number of glyphs discarded by clipping, horizontally or by CPU fine clipping (lines skipped above/below the clipping rectangle are not decoded hence not counted)
+    int             VtxCount;           // Number of vertices output (4 per glyph)
+
+    ImDrawTextStats()                       { Clear(); }
+    void    Clear()                         { Font = NULL; TextCount = GlyphCount = GlyphClippedCount = VtxCount = 0; }
+    void    Add(const ImDrawTextStats& o)   { TextCount += o.TextCount; GlyphCount += o.GlyphCount; GlyphClippedCount += o.GlyphClippedCount; VtxCount += o.VtxCount; }
+};
+
 enum ImDrawCornerFlags_
 {
     ImDrawCornerFlags_TopLeft   = 1 << 0, // 0x1
@@ -1782,7 +1914,8 @@ enum ImDrawListFlags_
 {
     ImDrawListFlags_None             = 0,
     ImDrawListFlags_AntiAliasedLines = 1 << 0,  // Lines are anti-aliased (*2 the number of triangles for 1.0f wide line, otherwise *3 the number of triangles)
-    ImDrawListFlags_AntiAliasedFill  = 1 << 1   // Filled shapes have anti-aliased edges (*2 the number of vertices)
+    ImDrawListFlags_AntiAliasedFill  = 1 << 1,  // Filled shapes have anti-aliased edges (*2 the number of vertices)
+    ImDrawListFlags_AllowVtxOffset   = 1 << 2   // Can emit 'VtxOffset > 0' to allow large meshes with 16-bits indices. Set when 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
 };
 
 // Draw command list
@@ -1798,11 +1931,14 @@ struct ImDrawList
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
+    ImU64                   ContentHash;        // Hash of the buffers contents, computed by Render() when 'io.BackendFlags & ImGuiBackendFlags_RendererHasContentHash' is set. Preserved by Clear(). Combined with merged lists by ImDrawData::MergeCmdLists().
+    unsigned int            ContentGeneration;  // Incremented by Render() whenever the list content differs from the last time it was rendered (every time if hashing is disabled). Compare it to keep persistent GPU buffers per list.
 
     // [Internal, used while building lists]
     const ImDrawListSharedData* _Data;          // Pointer to shared draw data (you can use ImGui::GetDrawListSharedData() to get the one from current ImGui context)
     const char*             _OwnerName;         // Pointer to owner window's name for debugging
-    unsigned int            _VtxCurrentIdx;     // [Internal] == VtxBuffer.Size
+    unsigned int            _VtxCurrentOffset;  // [Internal] == VtxOffset of the current command, a new one is started whenever 16-bits indices would overflow (see ImDrawListFlags_AllowVtxOffset)
+    unsigned int            _VtxCurrentIdx;     // [Internal] == VtxBuffer.Size - _VtxCurrentOffset
     ImDrawVert*             _VtxWritePtr;       // [Internal] point within VtxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImDrawIdx*              _IdxWritePtr;       // [Internal] point within IdxBuffer.Data after each add command (to avoid using the ImVector<> operators too much)
     ImVector<ImVec4>        _ClipRectStack;     // [Internal]
@@ -1811,9 +1947,12 @@ struct ImDrawList
     int                     _ChannelsCurrent;   // [Internal] current channel number (0)
     int                     _ChannelsCount;     // [Internal] number of active channels (1+)
     ImVector<ImDrawChannel> _Channels;          // [Internal] draw channels for columns API (not resized down so _ChannelsCount may be smaller than _Channels.Size)
+    ImU64                   _ContentHashPrev;   // [Internal] ContentHash of the previous rendering
+    bool                    _ContentChanged;    // [Internal] ContentGeneration was incremented by the last Render() (or by ImDrawData::MergeCmdLists())
+    ImVector<ImDrawTextStats> _TextStats;       // [Internal] text rendering counters, one entry per font used, see GetTextStats()
 
     // If you want to create ImDrawList instances, pass them ImGui::GetDrawListSharedData() or create and use your own ImDrawListSharedData (so you can use ImDrawList without ImGui)
-    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; Clear(); }
+    ImDrawList(const ImDrawListSharedData* shared_data) { _Data = shared_data; _OwnerName = NULL; ContentHash = 0; ContentGeneration = 0; _ContentHashPrev = 0; _ContentChanged = true; Clear(); }
     ~ImDrawList() { ClearFreeMemory(); }
     IMGUI_API void  PushClipRect(ImVec2 clip_rect_min, ImVec2 clip_rect_max, bool intersect_with_current_clip_rect = false);  // Render-level scissoring. This is passed down to your render function but not used for CPU-side coarse clipping. Prefer using higher-level ImGui::PushClipRect() to affect logic (hit-testing and widget culling)
     IMGUI_API void  PushClipRectFullScreen();
@@ -1861,10 +2000,19 @@ struct ImDrawList
     IMGUI_API void  ChannelsMerge();
     IMGUI_API void  ChannelsSetCurrent(int channel_index);
 
+    // Cached blocks
+    // - Record everything added between BeginCachedBlock()/EndCachedBlock() into an ImDrawCachedBlock, and on following frames call AddCachedBlock() instead of re-submitting the same primitives.
+    // - AddCachedBlock() translates vertices and clipping rectangles by 'offset', then intersects clipping rectangles with the current one of the destination list.
+    // - Don't switch channels while recording. Texture ids and callbacks are replayed as recorded.
+    IMGUI_API void  BeginCachedBlock(ImDrawCachedBlock* block);
+    IMGUI_API void  EndCachedBlock(ImDrawCachedBlock* block);
+    IMGUI_API void  AddCachedBlock(const ImDrawCachedBlock& block, const ImVec2& offset = ImVec2(0,0));
+
     // Advanced
     IMGUI_API void  AddCallback(ImDrawCallback callback, void* callback_data);  // Your rendering function must check for 'UserCallback' in ImDrawCmd and call the function instead of rendering triangles.
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API ImDrawTextStats GetTextStats(const ImFont* font = NULL) const;    // Text rendering counters since the list was cleared, for a given font or summed over all fonts (NULL).
 
     // Internal helpers
     // NB: all primitives needs to be reserved via PrimReserve() beforehand!
@@ -1879,6 +2027,7 @@ struct ImDrawList
     inline    void  PrimVtx(const ImVec2& pos, const ImVec2& uv, ImU32 col)     { PrimWriteIdx((ImDrawIdx)_VtxCurrentIdx); PrimWriteVtx(pos, uv, col); }
     IMGUI_API void  UpdateClipRect();
     IMGUI_API void  UpdateTextureID();
+    IMGUI_API ImDrawTextStats* _GetTextStats(const ImFont* font);               // Find or add the counters for 'font' in _TextStats[]
 };
 
 // All draw data to render an ImGui frame
@@ -1890,15 +2039,18 @@ struct ImDrawData
     int             CmdListsCount;          // Number of ImDrawList* to render
     int             TotalIdxCount;          // For convenience, sum of all ImDrawList's IdxBuffer.Size
     int             TotalVtxCount;          // For convenience, sum of all ImDrawList's VtxBuffer.Size
+    int             CmdListsChangedCount;   // Number of ImDrawList whose content changed since the last time they were rendered. Always == CmdListsCount unless the back-end sets ImGuiBackendFlags_RendererHasContentHash.
     ImVec2          DisplayPos;             // Upper-left position of the viewport to render (== upper-left of the orthogonal projection matrix to use)
     ImVec2          DisplaySize;            // Size of the viewport to render (== io.DisplaySize for the main viewport) (DisplayPos + DisplaySize == lower-right of the orthogonal projection matrix to use)
 
     // Functions
     ImDrawData()    { Valid = false; Clear(); }
     ~ImDrawData()   { Clear(); }
-    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = 0; DisplayPos = DisplaySize = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
+    void Clear()    { Valid = false; CmdLists = NULL; CmdListsCount = TotalVtxCount = TotalIdxCount = CmdListsChangedCount = 0; DisplayPos = DisplaySize = ImVec2(0.f, 0.f); } // The ImDrawList are owned by ImGuiContext!
     IMGUI_API void  DeIndexAllBuffers();                // Helper to convert all buffers from indexed to non-indexed, in case you cannot render indexed. Note: this is slow and most likely a waste of resources. Always prefer indexed rendering!
     IMGUI_API void  ScaleClipRects(const ImVec2& sc);   // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
+    bool            IsCmdListChanged(int n) const       { IM_ASSERT(n >= 0 && n < CmdListsCount); return CmdLists[n]->_ContentChanged; } // Return false if CmdLists[n] content is identical to the previous frame. Back-ends keeping persistent buffers per list should rather store and compare ImDrawList::ContentGeneration.
+    IMGUI_API int   MergeCmdLists();                    // Helper to append all ImDrawList into the first one (or as few as 16-bit indices allow) and merge adjacent ImDrawCmd sharing the same texture and clipping rectangle (or not clipping any vertex). Returns the number of draw calls saved. Note: this modifies the draw lists in place, call after Render() and before your render function.
 };
 
 //-----------------------------------------------------------------------------
@@ -1923,6 +2075,8 @@ struct ImFontConfig
     bool            MergeMode;              // false    // Merge into previous ImFont, so you can combine multiple inputs font into one ImFont (e.g. ASCII font + icons + Japanese glyphs). You may want to use GlyphOffset.y when merge font of different heights.
     unsigned int    RasterizerFlags;        // 0x00     // Settings for custom font rasterizer (e.g. ImGuiFreeType). Leave as zero if you aren't using one.
     float           RasterizerMultiply;     // 1.0f     // Brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable.
+    bool            SignedDistanceField;    // false    // [BETA] Store glyphs as a signed distance field, so text stays sharp when scaled up (SetWindowFontScale(), io.FontGlobalScale, zooming) without rebuilding the atlas. Needs a renderer back-end setting ImFontAtlas::TexIDSDF. OversampleH/V and RasterizerMultiply are ignored. Not supported by the FreeType builder.
+    int             SDFPadding;             // 4        // With SignedDistanceField: distance range in pixels (at SizePixels) stored around glyph edges. Larger values allow smaller scales and outline effects, at the cost of texture space.
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -1933,19 +2087,39 @@ struct ImFontConfig
 
 struct ImFontGlyph
 {
-    ImWchar         Codepoint;          // 0x0000..0xFFFF
+    ImWchar         Codepoint;          // 0x0000..IM_UNICODE_CODEPOINT_MAX
     float           AdvanceX;           // Distance to next character (= data from font + ImFontConfig::GlyphExtraSpacing.x baked in)
     float           X0, Y0, X1, Y1;     // Glyph corners
     float           U0, V0, U1, V1;     // Texture coordinates
 };
 
+// A line of word-wrapped text, see ImFont::CalcWordWrapLayoutA().
+// Offsets are relative to the beginning of the text. Blanks skipped by wrapping and '\n' characters are between lines.
+struct ImFontWrapLine
+{
+    int             TextBegin;          // Offset of the first character of the line
+    int             TextEnd;            // Offset past the last character of the line
+    float           Width;              // Width of the line, same as ImFont::CalcTextSizeA() on the line contents
+    int             GlyphsBegin;        // Range of the line characters in the 'out_glyphs' array passed to CalcWordWrapLayoutA(), if any
+    int             GlyphsEnd;
+};
+
+// A character position within a line of word-wrapped text, see ImFont::CalcWordWrapLayoutA().
+// Every character of the line which advances the cursor is listed (including blanks, which RenderText() doesn't draw), but not '\r'.
+struct ImFontWrapGlyph
+{
+    int             TextOffset;         // Offset of the character in the text
+    ImWchar         Codepoint;
+    float           X;                  // Position relative to the beginning of the line, same as ImFont::CalcTextSizeA() on the preceding characters of the line
+};
+
 // Helper to build glyph ranges from text/string data. Feed your application strings/characters to it then call BuildRanges().
 // This is essentially a tightly packed of vector of 64k booleans = 8KB storage.
 struct ImFontGlyphRangesBuilder
 {
     ImVector<int> UsedChars;            // Store 1-bit per Unicode code point (0=unused, 1=used)
 
-    ImFontGlyphRangesBuilder()          { UsedChars.resize(0x10000 / sizeof(int)); memset(UsedChars.Data, 0, 0x10000 / sizeof(int)); }
+    ImFontGlyphRangesBuilder()          { UsedChars.resize((IM_UNICODE_CODEPOINT_MAX + 1) / 32); memset(UsedChars.Data, 0, (size_t)UsedChars.Size * sizeof(int)); }
     bool           GetBit(int n) const  { int off = (n >> 5); int mask = 1 << (n & 31); return (UsedChars[off] & mask) != 0; } // Get bit n in the array
     void           SetBit(int n)        { int off = (n >> 5); int mask = 1 << (n & 31); UsedChars[off] |= mask; }              // Set bit n in the array
     void           AddChar(ImWchar c)   { SetBit(c); }                          // Add character
@@ -1958,7 +2132,10 @@ enum ImFontAtlasFlags_
 {
     ImFontAtlasFlags_None               = 0,
     ImFontAtlasFlags_NoPowerOfTwoHeight = 1 << 0,   // Don't round the height to next power of two
-    ImFontAtlasFlags_NoMouseCursors     = 1 << 1    // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_NoMouseCursors     = 1 << 1,   // Don't build software mouse cursors into the atlas
+    ImFontAtlasFlags_DynamicGlyphs      = 1 << 2    // [BETA] Build() only rasterizes U+0000..U+00FF, other glyphs of the requested ranges are rasterized the first time they are looked up.
+                                                    // The texture has a fixed size of TexDesiredWidth*TexDesiredWidth (default 1024*1024), least recently used glyphs are evicted when it is full.
+                                                    // Renderer back-end needs to upload TexDirtyRects[] every frame. Don't call ClearTexData()/ClearInputData() after building.
 };
 
 // Load and rasterize multiple TTF/OTF fonts into a same texture. The font atlas will build a single texture holding:
@@ -2004,6 +2181,13 @@ struct ImFontAtlas
     bool                        IsBuilt()                   { return Fonts.Size > 0 && (TexPixelsAlpha8 != NULL || TexPixelsRGBA32 != NULL); }
     void                        SetTexID(ImTextureID id)    { TexID = id; }
 
+    // Build cache: save the result of Build() to skip font parsing, rasterization and packing on the next runs.
+    // The cache holds a hash of the inputs (fonts data and settings, glyph ranges, custom rectangles, atlas settings): LoadCacheFromMemory() fails if they changed, then call Build().
+    // Pixels you wrote into custom rectangles are only stored if you call SaveCacheToMemory() after writing them. The hash doesn't identify the rasterizer (e.g. misc/freetype/), use one cache per rasterizer.
+    IMGUI_API bool              LoadCacheFromMemory(const void* data, size_t data_size);    // Setup fonts and texture from cache data (e.g. a memory-mapped file, which can be released after this call). Return false if it doesn't match the current inputs.
+    IMGUI_API bool              SaveCacheToMemory(ImVector<unsigned char>* out_data);       // Serialize a built atlas. Return false if the atlas isn't built or uses ImFontAtlasFlags_DynamicGlyphs.
+    IMGUI_API bool              BuildWithCacheFile(const char* filename);                   // Load atlas from the given cache file, or Build() and write the cache file.
+
     //-------------------------------------------
     // Glyph Ranges
     //-------------------------------------------
@@ -2052,9 +2236,16 @@ struct ImFontAtlas
     bool                        Locked;             // Marked as Locked by ImGui::NewFrame() so attempt to modify the atlas will assert.
     ImFontAtlasFlags            Flags;              // Build flags (see ImFontAtlasFlags_)
     ImTextureID                 TexID;              // User data to refer to the texture once it has been uploaded to user's graphic systems. It is passed back to you during rendering via the ImDrawCmd structure.
+    ImTextureID                 TexIDSDF;           // Texture identifier used instead of TexID by fonts using ImFontConfig::SignedDistanceField. Set by renderer back-ends which can sample the same texture with a distance field shader (see imgui_impl_opengl3.cpp). If NULL, TexID is used and those fonts render blurry.
     int                         TexDesiredWidth;    // Texture width desired by user before Build(). Must be a power-of-two. If have many glyphs your graphics API have texture size restrictions you may want to increase texture width to decrease height.
     int                         TexGlyphPadding;    // Padding between glyphs within texture in pixels. Defaults to 1. If your rendering method doesn't rely on bilinear filtering you may set this to 0.
 
+    // [BETA] Parallel build: if set, Build() calls BuildParallelForFunc() to rasterize glyphs, e.g. using your job system. It must call job_func(job_data, n) once for each n in [0, job_count)
+    // from any threads, and return when they are all completed. The texture is identical to a serial build. Memory allocations made by jobs call the functions set with SetAllocatorFunctions()
+    // directly (they are not counted in io.MetricsActiveAllocations), so those need to be thread-safe. Defaults to NULL (serial), or to a std::thread implementation with IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS.
+    void                        (*BuildParallelForFunc)(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void* user_data);
+    void*                       BuildParallelForUserData;
+
     // [Internal]
     // NB: Access texture data via GetTexData*() calls! Which will setup a default font for you.
     unsigned char*              TexPixelsAlpha8;    // 1 component per pixel, each component is unsigned 8-bit. Total size = TexWidth * TexHeight
@@ -2068,6 +2259,11 @@ struct ImFontAtlas
     ImVector<ImFontConfig>      ConfigData;         // Internal data
     int                         CustomRectIds[1];   // Identifiers of custom texture rectangle used by ImFontAtlas/ImDrawList
 
+    // [BETA] With ImFontAtlasFlags_DynamicGlyphs: areas of the texture modified after Build(). Renderer back-end needs to upload them before rendering then clear the list.
+    struct DirtyRect { unsigned short X, Y, Width, Height; };
+    ImVector<DirtyRect>         TexDirtyRects;
+    ImFontAtlasDynamicGlyphs*   DynamicGlyphs;      // Glyphs rasterized on demand, see ImFontAtlasFlags_DynamicGlyphs
+
 #ifndef IMGUI_DISABLE_OBSOLETE_FUNCTIONS
     typedef ImFontGlyphRangesBuilder GlyphRangesBuilder; // OBSOLETE 1.67+
 #endif
@@ -2082,8 +2278,9 @@ struct ImFont
     float                       Scale;              // = 1.f        // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     ImVec2                      DisplayOffset;      // = (0.f,0.f)  // Offset font rendering by xx pixels
     ImVector<ImFontGlyph>       Glyphs;             //              // All glyphs.
-    ImVector<float>             IndexAdvanceX;      //              // Sparse. Glyphs->AdvanceX in a directly indexable way (more cache-friendly, for CalcTextSize functions which are often bottleneck in large UI).
-    ImVector<ImWchar>           IndexLookup;        //              // Sparse. Index glyphs by Unicode code-point.
+    ImVector<float>             IndexAdvanceX;      //              // Paged. Glyphs->AdvanceX in a directly indexable way (more cache-friendly, for CalcTextSize functions which are often bottleneck in large UI).
+    ImVector<unsigned short>    IndexLookup;        //              // Paged. Index glyphs by Unicode code-point (0xFFFF = no glyph).
+    ImVector<unsigned short>    IndexPages;         //              // Code-point / 256 -> page of 256 entries in IndexAdvanceX[]/IndexLookup[]. Page 0 is shared by all code-points without glyphs.
     const ImFontGlyph*          FallbackGlyph;      // == FindGlyph(FontFallbackChar)
     float                       FallbackAdvanceX;   // == FallbackGlyph->AdvanceX
     ImWchar                     FallbackChar;       // = '?'        // Replacement glyph if one isn't found. Only set via SetFallbackChar()
@@ -2095,6 +2292,8 @@ struct ImFont
     float                       Ascent, Descent;    //              // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     bool                        DirtyLookupTables;
     int                         MetricsTotalSurface;//              // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    ImDrawTextStats             MetricsText;        //              // Text rendered with this font during the last call to ImGui::Render(), summed over all rendered draw lists (only for fonts of io.Fonts)
+    ImVector<int>               GlyphsLastUsedFrame;//              // With ImFontAtlasFlags_DynamicGlyphs: frame each glyph was last looked up, for least recently used eviction. Empty otherwise.
 
     // Methods
     IMGUI_API ImFont();
@@ -2103,20 +2302,25 @@ struct ImFont
     IMGUI_API void              BuildLookupTable();
     IMGUI_API const ImFontGlyph*FindGlyph(ImWchar c) const;
     IMGUI_API const ImFontGlyph*FindGlyphNoFallback(ImWchar c) const;
+    IMGUI_API void              FindGlyphs(const ImWchar* chars, int count, const ImFontGlyph** out_glyphs) const; // Same as calling FindGlyph() on each character. Pointers are valid until the next call to FindGlyph()/FindGlyphs().
     IMGUI_API void              SetFallbackChar(ImWchar c);
-    float                       GetCharAdvance(ImWchar c) const     { return ((int)c < IndexAdvanceX.Size) ? IndexAdvanceX[(int)c] : FallbackAdvanceX; }
+    float                       GetCharAdvance(unsigned int c) const { return ((c >> 8) < (unsigned int)IndexPages.Size) ? IndexAdvanceX.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)] : FallbackAdvanceX; }
+    IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last) const;
     bool                        IsLoaded() const                    { return ContainerAtlas != NULL; }
     const char*                 GetDebugName() const                { return ConfigData ? ConfigData->Name : "<unknown>"; }
+    ImTextureID                 GetTexID() const                    { return (ConfigData && ConfigData->SignedDistanceField && ContainerAtlas->TexIDSDF) ? ContainerAtlas->TexIDSDF : ContainerAtlas->TexID; }
 
     // 'max_width' stops rendering after a certain width (could be turned into a 2d size). FLT_MAX to disable.
     // 'wrap_width' enable automatic word-wrapping across multiple lines to fit into given width. 0.0f to disable.
     IMGUI_API ImVec2            CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end = NULL, const char** remaining = NULL) const; // utf8
     IMGUI_API const char*       CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const;
+    IMGUI_API ImVec2            CalcWordWrapLayoutA(float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<ImFontWrapLine>* out_lines, ImVector<ImFontWrapGlyph>* out_glyphs = NULL) const; // utf8. Word-wrap the whole text in a single pass, appending lines to out_lines and optionally character positions to out_glyphs. Return the same size as CalcTextSizeA(size, FLT_MAX, wrap_width, ...).
     IMGUI_API void              RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, ImWchar c) const;
     IMGUI_API void              RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width = 0.0f, bool cpu_fine_clip = false) const;
 
     // [Internal]
     IMGUI_API void              GrowIndex(int new_size);
+    IMGUI_API int               GetIndexSlot(unsigned int c);   // Offset of code-point 'c' in IndexAdvanceX[]/IndexLookup[] for writing, allocating its page if needed
     IMGUI_API void              AddGlyph(ImWchar c, float x0, float y0, float x1, float y1, float u0, float v0, float u1, float v1, float advance_x);
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
 
@@ -330,6 +330,14 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::Checkbox("io.ConfigWindowsResizeFromEdges", &io.ConfigWindowsResizeFromEdges);
             ImGui::SameLine(); ShowHelpMarker("Enable resizing of windows from their edges and from the lower-left corner.\nThis requires (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors) because it needs mouse cursor feedback.");
             ImGui::Checkbox("io.ConfigWindowsMoveFromTitleBarOnly", &io.ConfigWindowsMoveFromTitleBarOnly);
+            ImGui::Checkbox("io.ConfigStorageUseHashMap", &io.ConfigStorageUseHashMap);
+            ImGui::SameLine(); ShowHelpMarker("Index ImGuiStorage instances (windows lookup, tree nodes states, etc.) with a hash table for O(1) queries and insertions.\nStorages switch on their next insertion.");
+            ImGui::Checkbox("io.ConfigTextGlyphRunCache", &io.ConfigTextGlyphRunCache);
+            ImGui::SameLine(); ShowHelpMarker("Cache the layout of text across frames, so static labels are emitted by copying cached vertices.\nSee Metrics window for hit/miss counters.");
+            ImGui::Checkbox("io.ConfigTextWrapLayoutCache", &io.ConfigTextWrapLayoutCache);
+            ImGui::SameLine(); ShowHelpMarker("Cache line breaks of word-wrapped text across frames, so long wrapped paragraphs are not wrapped again every frame.\nOn resize, only visible paragraphs are wrapped again.");
+            ImGui::Checkbox("io.ConfigWindowsOcclusionCulling", &io.ConfigWindowsOcclusionCulling);
+            ImGui::SameLine(); ShowHelpMarker("Hide windows fully covered by an opaque window in front of them on the previous frame: their Begin() returns false.\nOnly windows with fully opaque background and title bar colors hide other windows.\nSee Metrics window for counters.");
             ImGui::Checkbox("io.MouseDrawCursor", &io.MouseDrawCursor);
             ImGui::SameLine(); ShowHelpMarker("Instruct Dear ImGui to render a mouse cursor for you. Note that a mouse cursor rendered via your application GPU rendering path will feel more laggy than hardware cursor, but will be more in sync with your other visuals.\n\nSome desktop applications may use both kinds of cursors (e.g. enable software cursor only when resizing/dragging something).");
             ImGui::TreePop();
@@ -343,6 +351,8 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasGamepad", (unsigned int *)&backend_flags, ImGuiBackendFlags_HasGamepad);
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors", (unsigned int *)&backend_flags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos", (unsigned int *)&backend_flags, ImGuiBackendFlags_HasSetMousePos);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", (unsigned int *)&backend_flags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasContentHash", (unsigned int *)&backend_flags, ImGuiBackendFlags_RendererHasContentHash);
             ImGui::TreePop();
             ImGui::Separator();
         }
@@ -982,6 +992,27 @@ static void ShowDemoWindowWidgets()
         ImGui::PlotHistogram("Histogram", func, NULL, display_count, 0, NULL, -1.0f, 1.0f, ImVec2(0,80));
         ImGui::Separator();
 
+        // Use a min/max pyramid to plot a large amount of samples. Each column of pixels displays the min/max of the samples it covers, so spikes are never missed.
+        static ImGuiPlotPyramid samples;
+        static unsigned int samples_rand = 1;
+        if (samples.Size() == 0 || (animate && samples.Size() < 4 * 1024 * 1024))
+        {
+            float new_samples[4096];
+            for (int n = 0; n < IM_ARRAYSIZE(new_samples); n++)
+            {
+                samples_rand = samples_rand * 1103515245 + 12345;
+                const int i = samples.Size() + n;
+                new_samples[n] = 0.5f * sinf(i * 0.0001f) + 0.1f * ((samples_rand >> 16) & 0xFF) / 255.0f + (((samples_rand >> 8) & 0xFFFF) == 0 ? 0.4f : 0.0f);
+            }
+            samples.AddSamples(new_samples, IM_ARRAYSIZE(new_samples));
+        }
+        char overlay[32];
+        sprintf(overlay, "%d samples", samples.Size());
+        ImGui::PlotLines("Lines##pyramid", &samples, 0, -1, overlay, -1.0f, 1.0f, ImVec2(0,80));
+        ImGui::SameLine(); ShowHelpMarker("Plotting from an ImGuiPlotPyramid, in O(graph width).");
+        ImGui::PlotHistogram("Histogram##pyramid", &samples, 0, -1, NULL, FLT_MAX, FLT_MAX, ImVec2(0,80));
+        ImGui::Separator();
+
         // Animate a simple progress bar
         static float progress = 0.0f, progress_dir = 1.0f;
         if (animate)
@@ -2680,10 +2711,16 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.ConfigInputTextCursorBlink)                              ImGui::Text("io.ConfigInputTextCursorBlink");
         if (io.ConfigWindowsResizeFromEdges)                            ImGui::Text("io.ConfigWindowsResizeFromEdges");
         if (io.ConfigWindowsMoveFromTitleBarOnly)                       ImGui::Text("io.ConfigWindowsMoveFromTitleBarOnly");
+        if (io.ConfigStorageUseHashMap)                                 ImGui::Text("io.ConfigStorageUseHashMap");
+        if (io.ConfigTextGlyphRunCache)                                 ImGui::Text("io.ConfigTextGlyphRunCache");
+        if (io.ConfigTextWrapLayoutCache)                               ImGui::Text("io.ConfigTextWrapLayoutCache");
+        if (io.ConfigWindowsOcclusionCulling)                           ImGui::Text("io.ConfigWindowsOcclusionCulling");
         ImGui::Text("io.BackendFlags: 0x%08X", io.BackendFlags);
         if (io.BackendFlags & ImGuiBackendFlags_HasGamepad)             ImGui::Text(" HasGamepad");
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasContentHash) ImGui::Text(" RendererHasContentHash");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -2902,17 +2939,23 @@ void ImGui::ShowStyleEditor(ImGuiStyle* ref)
                     ImGui::Text("Ascent: %f, Descent: %f, Height: %f", font->Ascent, font->Descent, font->Ascent - font->Descent);
                     ImGui::Text("Fallback character: '%c' (%d)", font->FallbackChar, font->FallbackChar);
                     ImGui::Text("Texture surface: %d pixels (approx) ~ %dx%d", font->MetricsTotalSurface, (int)sqrtf((float)font->MetricsTotalSurface), (int)sqrtf((float)font->MetricsTotalSurface));
+                    ImGui::Text("Glyph index: %d pages of 256 code-points, %d bytes", font->IndexLookup.Size / 256, (int)(font->IndexLookup.Size * (sizeof(unsigned short) + sizeof(float)) + font->IndexPages.Size * sizeof(unsigned short)));
                     for (int config_i = 0; config_i < font->ConfigDataCount; config_i++)
                         if (ImFontConfig* cfg = &font->ConfigData[config_i])
                             ImGui::BulletText("Input %d: \'%s\', Oversample: (%d,%d), PixelSnapH: %d", config_i, cfg->Name, cfg->OversampleH, cfg->OversampleV, cfg->PixelSnapH);
                     if (ImGui::TreeNode("Glyphs", "Glyphs (%d)", font->Glyphs.Size))
                     {
                         // Display all glyphs of the fonts in separate pages of 256 characters
-                        for (int base = 0; base < 0x10000; base += 256)
+                        for (int base = 0; base <= IM_UNICODE_CODEPOINT_MAX; base += 256)
                         {
+                            if (font->IsGlyphRangeUnused(base, base + 255))
+                                continue;
+
+                            // (Count from the lookup table so glyphs of collapsed pages are not rasterized with ImFontAtlasFlags_DynamicGlyphs)
+                            const unsigned short* index_page = font->IndexLookup.Data + (font->IndexPages[base >> 8] << 8);
                             int count = 0;
                             for (int n = 0; n < 256; n++)
-                                count += font->FindGlyphNoFallback((ImWchar)(base + n)) ? 1 : 0;
+                                count += (index_page[n] != 0xFFFF) ? 1 : 0;
                             if (count > 0 && ImGui::TreeNode((void*)(intptr_t)base, "U+%04X..U+%04X (%d %s)", base, base + 255, count, count > 1 ? "glyphs" : "glyph"))
                             {
                                 float cell_size = font->FontSize * 1;
@@ -3191,7 +3234,7 @@ struct ExampleAppConsole
         // However, note that you can not use this code as is if a filter is active because it breaks the 'cheap random-access' property. We would need random-access on the post-filtered list.
         // A typical application wanting coarse clipping and filtering may want to pre-compute an array of indices that passed the filtering test, recomputing this array when user changes the filter,
         // and appending newly elements as they are inserted. This is left as a task to the user until we can manage to improve this example code!
-        // If your items are of variable size you may want to implement code similar to what ImGuiListClipper does. Or split your data into fixed height items to allow random-seeking into your list.
+        // If your items are of variable size you can pass an ImGuiListClipperHeights to the clipper, which will learn the height of each item as they are displayed.
         ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(4,1)); // Tighten spacing
         if (copy_to_clipboard)
             ImGui::LogToClipboard();
@@ -3671,7 +3714,7 @@ static void ShowExampleAppLongText(bool* p_open)
     static ImGuiTextBuffer log;
     static int lines = 0;
     ImGui::Text("Printing unusually long amount of text.");
-    ImGui::Combo("Test type", &test_type, "Single call to TextUnformatted()\0Multiple calls to Text(), clipped manually\0Multiple calls to Text(), not clipped (slow)\0");
+    ImGui::Combo("Test type", &test_type, "Single call to TextUnformatted()\0Multiple calls to Text(), clipped manually\0Multiple calls to Text(), not clipped (slow)\0Multiple calls to TextWrapped(), variable heights, clipped manually\0");
     ImGui::Text("Buffer contents: %d lines, %d bytes", lines, log.size());
     if (ImGui::Button("Clear")) { log.clear(); lines = 0; }
     ImGui::SameLine();
@@ -3706,6 +3749,24 @@ static void ShowExampleAppLongText(bool* p_open)
             ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
         ImGui::PopStyleVar();
         break;
+    case 3:
+        {
+            // Multiple calls to TextWrapped(), manually coarsely clipped - demonstrate how to use ImGuiListClipperHeights when items are not evenly spaced.
+            // The clipper learns the height of the items as they are displayed, so the scrollbar size settles as you scroll through the list.
+            static ImGuiListClipperHeights heights;
+            ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0,0));
+            ImGuiListClipper clipper(lines, &heights);
+            while (clipper.Step())
+                for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                {
+                    if ((i % 7) == 0)
+                        ImGui::TextWrapped("%i The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.", i);
+                    else
+                        ImGui::Text("%i The quick brown fox jumps over the lazy dog", i);
+                }
+            ImGui::PopStyleVar();
+            break;
+        }
     }
     ImGui::EndChild();
     ImGui::End();
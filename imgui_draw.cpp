@@ -15,6 +15,8 @@ Index of this file:
 // [SECTION] ImFontAtlas glyph ranges helpers
 // [SECTION] ImFontGlyphRangesBuilder
 // [SECTION] ImFont
+// [SECTION] ImFontGlyphRunCache
+// [SECTION] ImFontWrapLayoutCache
 // [SECTION] Internal Render Helpers
 // [SECTION] Decompression code
 // [SECTION] Default font data (ProggyClean.ttf)
@@ -44,6 +46,10 @@ Index of this file:
 #include <stdlib.h>     // alloca
 #endif
 #endif
+#ifdef IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS
+#include <atomic>       // std::atomic
+#include <thread>       // std::thread
+#endif
 
 // Visual Studio warnings
 #ifdef _MSC_VER
@@ -129,13 +135,29 @@ namespace IMGUI_STB_NAMESPACE
 
 #ifndef STB_TRUETYPE_IMPLEMENTATION                         // in case the user already have an implementation in the _same_ compilation unit (e.g. unity builds)
 #ifndef IMGUI_DISABLE_STB_TRUETYPE_IMPLEMENTATION
-#define STBTT_malloc(x,u)   ((void)(u), ImGui::MemAlloc(x))
-#define STBTT_free(x,u)     ((void)(u), ImGui::MemFree(x))
+// Font build jobs may run on other threads (see ImFontAtlas::BuildParallelForFunc): they set a non-NULL stbtt_fontinfo::userdata
+// and call the allocator directly, as ImGui::MemAlloc()/MemFree() update the context metrics.
+static void* ImFontAtlasBuildJobMemAlloc(size_t size)
+{
+    void* (*alloc_func)(size_t, void*); void (*free_func)(void*, void*); void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    return alloc_func(size, user_data);
+}
+static void ImFontAtlasBuildJobMemFree(void* ptr)
+{
+    void* (*alloc_func)(size_t, void*); void (*free_func)(void*, void*); void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    free_func(ptr, user_data);
+}
+#define STBTT_malloc(x,u)   ((u) ? ImFontAtlasBuildJobMemAlloc(x) : ImGui::MemAlloc(x))
+#define STBTT_free(x,u)     ((u) ? ImFontAtlasBuildJobMemFree(x) : ImGui::MemFree(x))
 #define STBTT_assert(x)     IM_ASSERT(x)
 #define STBTT_fmod(x,y)     ImFmod(x,y)
 #define STBTT_sqrt(x)       ImSqrt(x)
 #define STBTT_pow(x,y)      ImPow(x,y)
 #define STBTT_fabs(x)       ImFabs(x)
+#define STBTT_cos(x)        ImCos(x)
+#define STBTT_acos(x)       ImAcos(x)
 #define STBTT_ifloor(x)     ((int)ImFloorStd(x))
 #define STBTT_iceil(x)      ((int)ImCeil(x))
 #define STBTT_STATIC
@@ -347,6 +369,9 @@ ImDrawListSharedData::ImDrawListSharedData()
     FontSize = 0.0f;
     CurveTessellationTol = 0.0f;
     ClipRectFullscreen = ImVec4(-8192.0f, -8192.0f, +8192.0f, +8192.0f);
+    GlyphRunCache = NULL;
+    WrapLayoutCache = NULL;
+    GlyphsToLoad = NULL;
 
     // Const data
     for (int i = 0; i < IM_ARRAYSIZE(CircleVtx12); i++)
@@ -362,6 +387,7 @@ void ImDrawList::Clear()
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
     Flags = ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedFill;
+    _VtxCurrentOffset = 0;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
@@ -370,6 +396,7 @@ void ImDrawList::Clear()
     _Path.resize(0);
     _ChannelsCurrent = 0;
     _ChannelsCount = 1;
+    _TextStats.resize(0);
     // NB: Do not clear channels so our allocations are re-used after the first frame.
 }
 
@@ -378,6 +405,7 @@ void ImDrawList::ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    _VtxCurrentOffset = 0;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
     _IdxWritePtr = NULL;
@@ -386,6 +414,7 @@ void ImDrawList::ClearFreeMemory()
     _Path.clear();
     _ChannelsCurrent = 0;
     _ChannelsCount = 1;
+    _TextStats.clear();
     for (int i = 0; i < _Channels.Size; i++)
     {
         if (i == 0) memset(&_Channels[0], 0, sizeof(_Channels[0]));  // channel 0 is a copy of CmdBuffer/IdxBuffer, don't destruct again
@@ -405,6 +434,27 @@ ImDrawList* ImDrawList::CloneOutput() const
     return dst;
 }
 
+ImDrawTextStats ImDrawList::GetTextStats(const ImFont* font) const
+{
+    ImDrawTextStats stats;
+    stats.Font = font;
+    for (int n = 0; n < _TextStats.Size; n++)
+        if (font == NULL || _TextStats[n].Font == font)
+            stats.Add(_TextStats[n]);
+    return stats;
+}
+
+ImDrawTextStats* ImDrawList::_GetTextStats(const ImFont* font)
+{
+    // Linear search: a draw list rarely uses more than a few fonts
+    for (int n = 0; n < _TextStats.Size; n++)
+        if (_TextStats.Data[n].Font == font)
+            return &_TextStats.Data[n];
+    _TextStats.push_back(ImDrawTextStats());
+    _TextStats.back().Font = font;
+    return &_TextStats.back();
+}
+
 // Using macros because C++ is a terrible language, we want guaranteed inline, no code in header, and no overhead in Debug builds
 #define GetCurrentClipRect()    (_ClipRectStack.Size ? _ClipRectStack.Data[_ClipRectStack.Size-1]  : _Data->ClipRectFullscreen)
 #define GetCurrentTextureId()   (_TextureIdStack.Size ? _TextureIdStack.Data[_TextureIdStack.Size-1] : NULL)
@@ -414,6 +464,7 @@ void ImDrawList::AddDrawCmd()
     ImDrawCmd draw_cmd;
     draw_cmd.ClipRect = GetCurrentClipRect();
     draw_cmd.TextureId = GetCurrentTextureId();
+    draw_cmd.VtxOffset = _VtxCurrentOffset;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -440,7 +491,7 @@ void ImDrawList::UpdateClipRect()
     // If current command is used with different settings we need to add a new command
     const ImVec4 curr_clip_rect = GetCurrentClipRect();
     ImDrawCmd* curr_cmd = CmdBuffer.Size > 0 ? &CmdBuffer.Data[CmdBuffer.Size-1] : NULL;
-    if (!curr_cmd || (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &curr_clip_rect, sizeof(ImVec4)) != 0) || curr_cmd->UserCallback != NULL)
+    if (!curr_cmd || (curr_cmd->ElemCount != 0 && (memcmp(&curr_cmd->ClipRect, &curr_clip_rect, sizeof(ImVec4)) != 0 || curr_cmd->VtxOffset != _VtxCurrentOffset)) || curr_cmd->UserCallback != NULL)
     {
         AddDrawCmd();
         return;
@@ -448,10 +499,13 @@ void ImDrawList::UpdateClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = CmdBuffer.Size > 1 ? curr_cmd - 1 : NULL;
-    if (curr_cmd->ElemCount == 0 && prev_cmd && memcmp(&prev_cmd->ClipRect, &curr_clip_rect, sizeof(ImVec4)) == 0 && prev_cmd->TextureId == GetCurrentTextureId() && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && prev_cmd && memcmp(&prev_cmd->ClipRect, &curr_clip_rect, sizeof(ImVec4)) == 0 && prev_cmd->TextureId == GetCurrentTextureId() && prev_cmd->VtxOffset == _VtxCurrentOffset && prev_cmd->UserCallback == NULL)
         CmdBuffer.pop_back();
     else
+    {
         curr_cmd->ClipRect = curr_clip_rect;
+        curr_cmd->VtxOffset = _VtxCurrentOffset;
+    }
 }
 
 void ImDrawList::UpdateTextureID()
@@ -459,7 +513,7 @@ void ImDrawList::UpdateTextureID()
     // If current command is used with different settings we need to add a new command
     const ImTextureID curr_texture_id = GetCurrentTextureId();
     ImDrawCmd* curr_cmd = CmdBuffer.Size ? &CmdBuffer.back() : NULL;
-    if (!curr_cmd || (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != curr_texture_id) || curr_cmd->UserCallback != NULL)
+    if (!curr_cmd || (curr_cmd->ElemCount != 0 && (curr_cmd->TextureId != curr_texture_id || curr_cmd->VtxOffset != _VtxCurrentOffset)) || curr_cmd->UserCallback != NULL)
     {
         AddDrawCmd();
         return;
@@ -467,10 +521,13 @@ void ImDrawList::UpdateTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = CmdBuffer.Size > 1 ? curr_cmd - 1 : NULL;
-    if (curr_cmd->ElemCount == 0 && prev_cmd && prev_cmd->TextureId == curr_texture_id && memcmp(&prev_cmd->ClipRect, &GetCurrentClipRect(), sizeof(ImVec4)) == 0 && prev_cmd->UserCallback == NULL)
+    if (curr_cmd->ElemCount == 0 && prev_cmd && prev_cmd->TextureId == curr_texture_id && memcmp(&prev_cmd->ClipRect, &GetCurrentClipRect(), sizeof(ImVec4)) == 0 && prev_cmd->VtxOffset == _VtxCurrentOffset && prev_cmd->UserCallback == NULL)
         CmdBuffer.pop_back();
     else
+    {
         curr_cmd->TextureId = curr_texture_id;
+        curr_cmd->VtxOffset = _VtxCurrentOffset;
+    }
 }
 
 #undef GetCurrentClipRect
@@ -548,6 +605,7 @@ void ImDrawList::ChannelsSplit(int channels_count)
             ImDrawCmd draw_cmd;
             draw_cmd.ClipRect = _ClipRectStack.back();
             draw_cmd.TextureId = _TextureIdStack.back();
+            draw_cmd.VtxOffset = _VtxCurrentOffset;
             _Channels[i].CmdBuffer.push_back(draw_cmd);
         }
     }
@@ -597,11 +655,144 @@ void ImDrawList::ChannelsSetCurrent(int idx)
     memcpy(&CmdBuffer, &_Channels.Data[_ChannelsCurrent].CmdBuffer, sizeof(CmdBuffer));
     memcpy(&IdxBuffer, &_Channels.Data[_ChannelsCurrent].IdxBuffer, sizeof(IdxBuffer));
     _IdxWritePtr = IdxBuffer.Data + IdxBuffer.Size;
+
+    // Vertices are shared by all channels: if a new vertex offset was started while another channel was current, our last command can't use it as is.
+    ImDrawCmd* curr_cmd = CmdBuffer.Size > 0 ? &CmdBuffer.Data[CmdBuffer.Size-1] : NULL;
+    if (curr_cmd && curr_cmd->VtxOffset != _VtxCurrentOffset)
+    {
+        if (curr_cmd->ElemCount == 0 && curr_cmd->UserCallback == NULL)
+            curr_cmd->VtxOffset = _VtxCurrentOffset;
+        else
+            AddDrawCmd();
+    }
+}
+
+void ImDrawList::BeginCachedBlock(ImDrawCachedBlock* block)
+{
+    IM_ASSERT(!block->IsRecording() && "Called BeginCachedBlock() twice without EndCachedBlock()");
+    block->_CmdStart = ImMax(CmdBuffer.Size - 1, 0);
+    block->_IdxStart = IdxBuffer.Size;
+    block->_VtxStart = VtxBuffer.Size;
+    block->_Channel = _ChannelsCurrent;
+}
+
+void ImDrawList::EndCachedBlock(ImDrawCachedBlock* block)
+{
+    IM_ASSERT(block->IsRecording() && "Called EndCachedBlock() without BeginCachedBlock()");
+    IM_ASSERT(block->_Channel == _ChannelsCurrent && "Channel changed while recording a cached block");
+    IM_ASSERT(block->_IdxStart <= IdxBuffer.Size && block->_VtxStart <= VtxBuffer.Size);
+    block->CmdBuffer.resize(0);
+    block->IdxBuffer.resize(0);
+    block->VtxBuffer.resize(0);
+
+    // Commands may have been merged with the one preceding the recording (see UpdateClipRect), so we locate recorded commands by their index range.
+    unsigned int idx_offset = 0;
+    for (int cmd_n = 0; cmd_n < CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = CmdBuffer.Data[cmd_n];
+        const unsigned int idx_begin = ImMax(idx_offset, (unsigned int)block->_IdxStart);
+        const unsigned int idx_end = idx_offset + cmd.ElemCount;
+        idx_offset = idx_end;
+        if (cmd.UserCallback ? (cmd_n < block->_CmdStart) : (idx_end <= idx_begin))
+            continue;
+        block->CmdBuffer.push_back(cmd);
+        ImDrawCmd& block_cmd = block->CmdBuffer.back();
+        block_cmd.ElemCount = cmd.UserCallback ? 0 : idx_end - idx_begin;
+
+        // Store vertex offset and indices relative to the first recorded vertex
+        block_cmd.VtxOffset = ImMax(cmd.VtxOffset, (unsigned int)block->_VtxStart) - block->_VtxStart;
+        const unsigned int idx_rebase = block->_VtxStart + block_cmd.VtxOffset - cmd.VtxOffset;
+        for (unsigned int i = idx_begin; i < idx_end; i++)
+        {
+            IM_ASSERT(IdxBuffer.Data[i] >= idx_rebase);
+            block->IdxBuffer.push_back((ImDrawIdx)(IdxBuffer.Data[i] - idx_rebase));
+        }
+    }
+    const int vtx_count = VtxBuffer.Size - block->_VtxStart;
+    block->VtxBuffer.resize(vtx_count);
+    if (vtx_count > 0)
+        memcpy(block->VtxBuffer.Data, VtxBuffer.Data + block->_VtxStart, (size_t)vtx_count * sizeof(ImDrawVert));
+    block->_Channel = -1;
+}
+
+void ImDrawList::AddCachedBlock(const ImDrawCachedBlock& block, const ImVec2& offset)
+{
+    IM_ASSERT(!block.IsRecording());
+    if (block.CmdBuffer.Size == 0)
+        return;
+
+    // Copy vertices (once for all commands)
+    const unsigned int vtx_base = (unsigned int)VtxBuffer.Size;
+    const int vtx_count = block.VtxBuffer.Size;
+    PrimReserve(0, vtx_count);
+    if (vtx_count > 0)
+        memcpy(_VtxWritePtr, block.VtxBuffer.Data, (size_t)vtx_count * sizeof(ImDrawVert));
+    if (offset.x != 0.0f || offset.y != 0.0f)
+        for (int i = 0; i < vtx_count; i++)
+        {
+            _VtxWritePtr[i].pos.x += offset.x;
+            _VtxWritePtr[i].pos.y += offset.y;
+        }
+    _VtxWritePtr += vtx_count;
+
+    // Replay commands, letting PushClipRect()/PushTextureID() merge them with the current command whenever possible
+    const ImDrawIdx* idx_read = block.IdxBuffer.Data;
+    for (int cmd_n = 0; cmd_n < block.CmdBuffer.Size; cmd_n++)
+    {
+        const ImDrawCmd& cmd = block.CmdBuffer.Data[cmd_n];
+        const unsigned int cmd_vtx_base = vtx_base + cmd.VtxOffset;
+        if (sizeof(ImDrawIdx) == 2 && (Flags & ImDrawListFlags_AllowVtxOffset) && cmd.UserCallback == NULL)
+        {
+            // Move our vertex offset forward if the indices of this command would overflow 16-bits from the current one
+            unsigned int idx_max = 0;
+            for (unsigned int i = 0; i < cmd.ElemCount; i++)
+                idx_max = ImMax(idx_max, (unsigned int)idx_read[i]);
+            if (cmd_vtx_base + idx_max - _VtxCurrentOffset >= (1 << 16))
+                _VtxCurrentOffset = cmd_vtx_base;
+        }
+        PushClipRect(ImVec2(cmd.ClipRect.x + offset.x, cmd.ClipRect.y + offset.y), ImVec2(cmd.ClipRect.z + offset.x, cmd.ClipRect.w + offset.y), true);
+        PushTextureID(cmd.TextureId);
+        if (cmd.UserCallback != NULL)
+        {
+            AddCallback(cmd.UserCallback, cmd.UserCallbackData);
+        }
+        else
+        {
+            const int idx_count = (int)cmd.ElemCount;
+            PrimReserve(idx_count, 0);
+            const unsigned int idx_rebase = cmd_vtx_base - _VtxCurrentOffset;
+            for (int i = 0; i < idx_count; i++)
+                _IdxWritePtr[i] = (ImDrawIdx)(idx_read[i] + idx_rebase);
+            _IdxWritePtr += idx_count;
+            idx_read += idx_count;
+        }
+        PopTextureID();
+        PopClipRect();
+    }
+    _VtxCurrentIdx = (unsigned int)VtxBuffer.Size - _VtxCurrentOffset;
+    if (sizeof(ImDrawIdx) == 2 && _VtxCurrentIdx >= (1 << 16) && (Flags & ImDrawListFlags_AllowVtxOffset))
+    {
+        _VtxCurrentOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+        AddDrawCmd();
+    }
 }
 
 // NB: this can be called with negative count for removing primitives (as long as the result does not underflow)
 void ImDrawList::PrimReserve(int idx_count, int vtx_count)
 {
+    // Large mesh support (when enabled): start a new command with a vertex offset instead of overflowing 16-bits indices.
+    if (sizeof(ImDrawIdx) == 2 && vtx_count > 0 && (_VtxCurrentIdx + vtx_count >= (1 << 16)) && (Flags & ImDrawListFlags_AllowVtxOffset))
+    {
+        _VtxCurrentOffset = VtxBuffer.Size;
+        _VtxCurrentIdx = 0;
+        ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size-1];
+        if (curr_cmd->ElemCount == 0 && curr_cmd->UserCallback == NULL)
+            curr_cmd->VtxOffset = _VtxCurrentOffset;
+        else
+            AddDrawCmd();
+    }
+
     ImDrawCmd& draw_cmd = CmdBuffer.Data[CmdBuffer.Size-1];
     draw_cmd.ElemCount += idx_count;
 
@@ -1189,7 +1380,13 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
     if (font_size == 0.0f)
         font_size = _Data->FontSize;
 
-    IM_ASSERT(font->ContainerAtlas->TexID == _TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    // Fonts using ImFontConfig::SignedDistanceField draw with ImFontAtlas::TexIDSDF: switch between the two textures of the atlas as needed
+    // (e.g. on the overlay draw list, which has TexID pushed), but any other texture means the font wasn't pushed.
+    const ImTextureID font_texture_id = font->GetTexID();
+    IM_ASSERT(font->ContainerAtlas->TexID == _TextureIdStack.back() || font->ContainerAtlas->TexIDSDF == _TextureIdStack.back());  // Use high-level ImGui::PushFont() or low-level ImDrawList::PushTextureId() to change font.
+    const bool push_texture_id = font_texture_id != _TextureIdStack.back();
+    if (push_texture_id)
+        PushTextureID(font_texture_id);
 
     ImVec4 clip_rect = _ClipRectStack.back();
     if (cpu_fine_clip_rect)
@@ -1200,6 +1397,9 @@ void ImDrawList::AddText(const ImFont* font, float font_size, const ImVec2& pos,
         clip_rect.w = ImMin(clip_rect.w, cpu_fine_clip_rect->w);
     }
     font->RenderText(this, font_size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip_rect != NULL);
+
+    if (push_texture_id)
+        PopTextureID();
 }
 
 void ImDrawList::AddText(const ImVec2& pos, ImU32 col, const char* text_begin, const char* text_end)
@@ -1279,14 +1479,161 @@ void ImDrawData::DeIndexAllBuffers()
         if (cmd_list->IdxBuffer.empty())
             continue;
         new_vtx_buffer.resize(cmd_list->IdxBuffer.Size);
-        for (int j = 0; j < cmd_list->IdxBuffer.Size; j++)
-            new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd_list->IdxBuffer[j]];
+        int idx_offset = 0;
+        for (int cmd_i = 0; cmd_i < cmd_list->CmdBuffer.Size; cmd_i++)
+        {
+            ImDrawCmd& cmd = cmd_list->CmdBuffer[cmd_i];
+            for (int j = idx_offset; j < idx_offset + (int)cmd.ElemCount; j++)
+                new_vtx_buffer[j] = cmd_list->VtxBuffer[cmd.VtxOffset + cmd_list->IdxBuffer[j]];
+            idx_offset += cmd.ElemCount;
+            cmd.VtxOffset = 0;
+        }
         cmd_list->VtxBuffer.swap(new_vtx_buffer);
         cmd_list->IdxBuffer.resize(0);
         TotalVtxCount += cmd_list->VtxBuffer.Size;
     }
 }
 
+// Return true if all vertices referenced by a command are within its clipping rectangle, in which case the clipping rectangle may be enlarged without affecting the output.
+// We keep a 1 pixel margin to be robust to the various ways back-ends round scissor rectangles.
+static bool DrawCmdIsInsideClipRect(const ImDrawList* draw_list, const ImDrawCmd& cmd, const ImDrawIdx* idx_buffer)
+{
+    const ImVec4& cr = cmd.ClipRect;
+    const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+    for (unsigned int i = 0; i < cmd.ElemCount; i++)
+    {
+        const ImVec2& pos = vtx_buffer[idx_buffer[i]].pos;
+        if (pos.x < cr.x + 1.0f || pos.y < cr.y + 1.0f || pos.x > cr.z - 1.0f || pos.y > cr.w - 1.0f)
+            return false;
+    }
+    return true;
+}
+
+// Update ContentGeneration of a list which other lists have been merged into, so back-ends skipping uploads of unchanged lists see it as changed whenever any of its parts did.
+// Render() compared the list own content to the merged content of the previous frame, so we may also need to revert its decision.
+static void DrawListUpdateMergedContentChanged(ImDrawList* draw_list, bool parts_changed)
+{
+    const bool changed = parts_changed || draw_list->ContentHash != draw_list->_ContentHashPrev;
+    if (changed != draw_list->_ContentChanged)
+        draw_list->ContentGeneration += changed ? 1 : -1;
+    draw_list->_ContentChanged = changed;
+}
+
+// Helper to reduce the number of draw calls: append all draw lists into the first one and merge adjacent commands which share the same texture and clipping rectangle.
+// Adjacent commands sharing the same texture but not the same clipping rectangle are also merged when none of their vertices are clipped, using the union of both rectangles.
+// This is typically the case of consecutive windows backgrounds and decorations.
+// - With 16-bit indices, a new output list is started whenever the merged list would overflow them, unless the list has ImDrawListFlags_AllowVtxOffset in which case we emit ImDrawCmd::VtxOffset.
+// - User callbacks are never merged and will receive the merged list as their 'parent_list'.
+// - This copies every vertex/index once more on the CPU, so it is only worth it if your renderer is bound by the number of draw calls.
+int ImDrawData::MergeCmdLists()
+{
+    int cmd_count_before = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+        cmd_count_before += CmdLists[i]->CmdBuffer.Size;
+
+    int dst_n = -1;
+    unsigned int dst_vtx_offset = 0;
+    bool dst_cmd_inside_clip_rect = false;
+    int dst_merged_count = 0;
+    bool dst_parts_changed = false;
+    for (int src_n = 0; src_n < CmdListsCount; src_n++)
+    {
+        ImDrawList* src_list = CmdLists[src_n];
+        ImDrawList* dst_list = (dst_n >= 0) ? CmdLists[dst_n] : NULL;
+        const bool dst_allow_vtx_offset = dst_list && (sizeof(ImDrawIdx) == 4 || (dst_list->Flags & ImDrawListFlags_AllowVtxOffset));
+        if (dst_list == NULL || (!dst_allow_vtx_offset && dst_list->VtxBuffer.Size + src_list->VtxBuffer.Size > (1 << 16)))
+        {
+            // Start a new output list
+            if (dst_list && dst_merged_count > 0)
+                DrawListUpdateMergedContentChanged(dst_list, dst_parts_changed);
+            CmdLists[++dst_n] = src_list;
+            dst_merged_count = 0;
+            dst_parts_changed = false;
+            dst_vtx_offset = src_list->CmdBuffer.Size ? src_list->CmdBuffer.back().VtxOffset : 0;
+            dst_cmd_inside_clip_rect = false;
+            if (src_list->CmdBuffer.Size && src_list->CmdBuffer.back().UserCallback == NULL)
+                dst_cmd_inside_clip_rect = DrawCmdIsInsideClipRect(src_list, src_list->CmdBuffer.back(), src_list->IdxBuffer.Data + src_list->IdxBuffer.Size - src_list->CmdBuffer.back().ElemCount);
+            continue;
+        }
+
+        // Append vertices
+        const unsigned int vtx_base = (unsigned int)dst_list->VtxBuffer.Size;
+        const int src_vtx_count = src_list->VtxBuffer.Size;
+        dst_list->VtxBuffer.resize(dst_list->VtxBuffer.Size + src_vtx_count);
+        if (src_vtx_count > 0)
+            memcpy(dst_list->VtxBuffer.Data + vtx_base, src_list->VtxBuffer.Data, (size_t)src_vtx_count * sizeof(ImDrawVert));
+
+        // Append commands and indices, rebasing indices to the output vertex offset
+        dst_list->IdxBuffer.reserve(dst_list->IdxBuffer.Size + src_list->IdxBuffer.Size);
+        const ImDrawIdx* idx_read = src_list->IdxBuffer.Data;
+        for (int cmd_n = 0; cmd_n < src_list->CmdBuffer.Size; cmd_n++)
+        {
+            const ImDrawCmd& src_cmd = src_list->CmdBuffer.Data[cmd_n];
+            const unsigned int cmd_vtx_base = vtx_base + src_cmd.VtxOffset;
+            if (src_cmd.UserCallback != NULL)
+            {
+                dst_list->CmdBuffer.push_back(src_cmd);
+                dst_list->CmdBuffer.back().VtxOffset = dst_vtx_offset;
+                continue;
+            }
+            if (src_cmd.ElemCount == 0)
+                continue;
+
+            // All indices of this command are < (src vertex count - src_cmd.VtxOffset), move our vertex offset forward if they may overflow 16-bit from it.
+            if (sizeof(ImDrawIdx) == 2 && cmd_vtx_base - dst_vtx_offset + (src_vtx_count - src_cmd.VtxOffset) > (1 << 16))
+                dst_vtx_offset = cmd_vtx_base;
+
+            const bool src_cmd_inside_clip_rect = DrawCmdIsInsideClipRect(src_list, src_cmd, idx_read);
+            ImDrawCmd* dst_cmd = dst_list->CmdBuffer.Size ? &dst_list->CmdBuffer.back() : NULL;
+            const bool same_state = dst_cmd && dst_cmd->UserCallback == NULL && dst_cmd->TextureId == src_cmd.TextureId && dst_cmd->VtxOffset == dst_vtx_offset;
+            if (same_state && memcmp(&dst_cmd->ClipRect, &src_cmd.ClipRect, sizeof(ImVec4)) == 0)
+            {
+                dst_cmd->ElemCount += src_cmd.ElemCount;
+                dst_cmd_inside_clip_rect &= src_cmd_inside_clip_rect;
+            }
+            else if (same_state && dst_cmd_inside_clip_rect && src_cmd_inside_clip_rect)
+            {
+                dst_cmd->ElemCount += src_cmd.ElemCount;
+                dst_cmd->ClipRect = ImVec4(ImMin(dst_cmd->ClipRect.x, src_cmd.ClipRect.x), ImMin(dst_cmd->ClipRect.y, src_cmd.ClipRect.y), ImMax(dst_cmd->ClipRect.z, src_cmd.ClipRect.z), ImMax(dst_cmd->ClipRect.w, src_cmd.ClipRect.w));
+            }
+            else
+            {
+                dst_list->CmdBuffer.push_back(src_cmd);
+                dst_list->CmdBuffer.back().VtxOffset = dst_vtx_offset;
+                dst_cmd_inside_clip_rect = src_cmd_inside_clip_rect;
+            }
+
+            const int idx_write_n = dst_list->IdxBuffer.Size;
+            const unsigned int idx_rebase = cmd_vtx_base - dst_vtx_offset;
+            dst_list->IdxBuffer.resize(idx_write_n + (int)src_cmd.ElemCount);
+            ImDrawIdx* idx_write = dst_list->IdxBuffer.Data + idx_write_n;
+            for (unsigned int i = 0; i < src_cmd.ElemCount; i++)
+                idx_write[i] = (ImDrawIdx)(idx_read[i] + idx_rebase);
+            idx_read += src_cmd.ElemCount;
+        }
+
+        // Keep the internal state consistent, as if the merged content had been submitted to the output list
+        dst_list->_VtxWritePtr = dst_list->VtxBuffer.Data + dst_list->VtxBuffer.Size;
+        dst_list->_IdxWritePtr = dst_list->IdxBuffer.Data + dst_list->IdxBuffer.Size;
+        dst_list->_VtxCurrentOffset = dst_vtx_offset;
+        dst_list->_VtxCurrentIdx = (unsigned int)dst_list->VtxBuffer.Size - dst_vtx_offset;
+        dst_list->ContentHash = ImHashData64(&src_list->ContentHash, sizeof(ImU64), dst_list->ContentHash);
+        dst_parts_changed |= src_list->_ContentChanged;
+        dst_merged_count++;
+    }
+    if (dst_n >= 0 && dst_merged_count > 0)
+        DrawListUpdateMergedContentChanged(CmdLists[dst_n], dst_parts_changed);
+    CmdListsCount = dst_n + 1;
+    CmdListsChangedCount = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+        CmdListsChangedCount += CmdLists[i]->_ContentChanged ? 1 : 0;
+
+    int cmd_count_after = 0;
+    for (int i = 0; i < CmdListsCount; i++)
+        cmd_count_after += CmdLists[i]->CmdBuffer.Size;
+    return cmd_count_before - cmd_count_after;
+}
+
 // Helper to scale the ClipRect field of each ImDrawCmd. Use if your final output buffer is at a different scale than ImGui expects, or if there is a difference between your window resolution and framebuffer resolution.
 void ImDrawData::ScaleClipRects(const ImVec2& scale)
 {
@@ -1370,6 +1717,8 @@ ImFontConfig::ImFontConfig()
     MergeMode = false;
     RasterizerFlags = 0x00;
     RasterizerMultiply = 1.0f;
+    SignedDistanceField = false;
+    SDFPadding = 4;
     memset(Name, 0, sizeof(Name));
     DstFont = NULL;
 }
@@ -1427,11 +1776,49 @@ static const ImVec2 FONT_ATLAS_DEFAULT_TEX_CURSOR_DATA[ImGuiMouseCursor_COUNT][3
     { ImVec2(91,0), ImVec2(17,22), ImVec2( 5, 0) }, // ImGuiMouseCursor_Hand
 };
 
+static void ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas* atlas);
+
+#ifdef IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS
+struct ImFontAtlasBuildThreadsData
+{
+    void                (*JobFunc)(void* job_data, int job_index);
+    void*               JobData;
+    int                 JobCount;
+    std::atomic<int>    NextJob;
+};
+
+static void ImFontAtlasBuildThreadsWorker(ImFontAtlasBuildThreadsData* data)
+{
+    for (int job_index = data->NextJob++; job_index < data->JobCount; job_index = data->NextJob++)
+        data->JobFunc(data->JobData, job_index);
+}
+
+// Default ImFontAtlas::BuildParallelForFunc when IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS is defined: spawn one worker thread per hardware thread.
+static void ImFontAtlasBuildParallelForStdThread(void (*job_func)(void* job_data, int job_index), void* job_data, int job_count, void*)
+{
+    ImFontAtlasBuildThreadsData data;
+    data.JobFunc = job_func;
+    data.JobData = job_data;
+    data.JobCount = job_count;
+    data.NextJob = 0;
+    const int threads_count = ImMin((int)std::thread::hardware_concurrency(), job_count) - 1;
+    ImVector<std::thread*> threads;
+    for (int n = 0; n < threads_count; n++)
+        threads.push_back(IM_NEW(std::thread)(ImFontAtlasBuildThreadsWorker, &data));
+    ImFontAtlasBuildThreadsWorker(&data);
+    for (int n = 0; n < threads.Size; n++)
+    {
+        threads[n]->join();
+        IM_DELETE(threads[n]);
+    }
+}
+#endif
+
 ImFontAtlas::ImFontAtlas()
 {
     Locked = false;
     Flags = ImFontAtlasFlags_None;
-    TexID = (ImTextureID)NULL;
+    TexID = TexIDSDF = (ImTextureID)NULL;
     TexDesiredWidth = 0;
     TexGlyphPadding = 1;
 
@@ -1442,6 +1829,13 @@ ImFontAtlas::ImFontAtlas()
     TexUvWhitePixel = ImVec2(0.0f, 0.0f);
     for (int n = 0; n < IM_ARRAYSIZE(CustomRectIds); n++)
         CustomRectIds[n] = -1;
+    DynamicGlyphs = NULL;
+#ifdef IMGUI_ENABLE_FONT_ATLAS_BUILD_THREADS
+    BuildParallelForFunc = ImFontAtlasBuildParallelForStdThread;
+#else
+    BuildParallelForFunc = NULL;
+#endif
+    BuildParallelForUserData = NULL;
 }
 
 ImFontAtlas::~ImFontAtlas()
@@ -1453,6 +1847,7 @@ ImFontAtlas::~ImFontAtlas()
 void    ImFontAtlas::ClearInputData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicGlyphsDestroy(this);
     for (int i = 0; i < ConfigData.Size; i++)
         if (ConfigData[i].FontData && ConfigData[i].FontDataOwnedByAtlas)
         {
@@ -1476,6 +1871,7 @@ void    ImFontAtlas::ClearInputData()
 void    ImFontAtlas::ClearTexData()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicGlyphsDestroy(this);
     if (TexPixelsAlpha8)
         ImGui::MemFree(TexPixelsAlpha8);
     if (TexPixelsRGBA32)
@@ -1487,6 +1883,7 @@ void    ImFontAtlas::ClearTexData()
 void    ImFontAtlas::ClearFonts()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicGlyphsDestroy(this);
     for (int i = 0; i < Fonts.Size; i++)
         IM_DELETE(Fonts[i]);
     Fonts.clear();
@@ -1724,6 +2121,258 @@ bool    ImFontAtlas::Build()
     return ImFontAtlasBuildWithStbTruetype(this);
 }
 
+//-----------------------------------------------------------------------------
+// ImFontAtlas build cache
+//-----------------------------------------------------------------------------
+// Data layout (native endianness, as the cache is meant to be read by the same executable):
+//  ImFontAtlasCacheHeader
+//  CustomRects.Size x { unsigned short X, Y }
+//  Fonts.Size x { ImFontAtlasCacheFont, GlyphsCount x ImFontGlyph }
+//  TexWidth * TexHeight x unsigned char (alpha texture)
+//-----------------------------------------------------------------------------
+
+#define IM_FONT_ATLAS_CACHE_MAGIC       0x41464D49  // "IMFA"
+#define IM_FONT_ATLAS_CACHE_VERSION     1
+
+struct ImFontAtlasCacheHeader
+{
+    ImU32   Magic;
+    ImU32   Version;
+    ImU32   InputsHash;
+    ImU32   SizeofGlyph;
+    int     TexWidth, TexHeight;
+    ImVec2  TexUvWhitePixel;
+    int     CustomRectsCount;
+    int     FontsCount;
+};
+
+struct ImFontAtlasCacheFont
+{
+    float   FontSize, Ascent, Descent;
+    int     ConfigDataIndex;                    // Index of ImFont::ConfigData in atlas->ConfigData[], -1 if NULL
+    int     ConfigDataCount;
+    int     MetricsTotalSurface;
+    int     GlyphsCount;
+};
+
+static int ImFontAtlasFindFontIndex(const ImFontAtlas* atlas, const ImFont* font)
+{
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        if (atlas->Fonts[font_n] == font)
+            return font_n;
+    return -1;
+}
+
+// Hash everything Build() depends on, except for the rasterizer itself
+static ImU32 ImFontAtlasCacheCalcInputsHash(const ImFontAtlas* atlas)
+{
+    ImU32 hash = IM_FONT_ATLAS_CACHE_VERSION;
+    hash = ImHashData(&atlas->Flags, sizeof(atlas->Flags), hash);
+    hash = ImHashData(&atlas->TexDesiredWidth, sizeof(atlas->TexDesiredWidth), hash);
+    hash = ImHashData(&atlas->TexGlyphPadding, sizeof(atlas->TexGlyphPadding), hash);
+    hash = ImHashData(&atlas->Fonts.Size, sizeof(atlas->Fonts.Size), hash);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        const ImFontConfig& cfg = atlas->ConfigData[src_i];
+        const int dst_index = ImFontAtlasFindFontIndex(atlas, cfg.DstFont);
+        hash = ImHashData(cfg.FontData, (size_t)cfg.FontDataSize, hash);
+        hash = ImHashData(&cfg.FontDataSize, sizeof(cfg.FontDataSize), hash);
+        hash = ImHashData(&cfg.FontNo, sizeof(cfg.FontNo), hash);
+        hash = ImHashData(&cfg.SizePixels, sizeof(cfg.SizePixels), hash);
+        hash = ImHashData(&cfg.OversampleH, sizeof(cfg.OversampleH), hash);
+        hash = ImHashData(&cfg.OversampleV, sizeof(cfg.OversampleV), hash);
+        hash = ImHashData(&cfg.PixelSnapH, sizeof(cfg.PixelSnapH), hash);
+        hash = ImHashData(&cfg.GlyphExtraSpacing, sizeof(cfg.GlyphExtraSpacing), hash);
+        hash = ImHashData(&cfg.GlyphOffset, sizeof(cfg.GlyphOffset), hash);
+        hash = ImHashData(&cfg.GlyphMinAdvanceX, sizeof(cfg.GlyphMinAdvanceX), hash);
+        hash = ImHashData(&cfg.GlyphMaxAdvanceX, sizeof(cfg.GlyphMaxAdvanceX), hash);
+        hash = ImHashData(&cfg.MergeMode, sizeof(cfg.MergeMode), hash);
+        hash = ImHashData(&cfg.RasterizerFlags, sizeof(cfg.RasterizerFlags), hash);
+        hash = ImHashData(&cfg.RasterizerMultiply, sizeof(cfg.RasterizerMultiply), hash);
+        hash = ImHashData(&cfg.SignedDistanceField, sizeof(cfg.SignedDistanceField), hash);
+        hash = ImHashData(&cfg.SDFPadding, sizeof(cfg.SDFPadding), hash);
+        hash = ImHashData(&dst_index, sizeof(dst_index), hash);
+        if (cfg.GlyphRanges)
+        {
+            const ImWchar* ranges_end = cfg.GlyphRanges;
+            while (ranges_end[0] && ranges_end[1])
+                ranges_end += 2;
+            hash = ImHashData(cfg.GlyphRanges, (size_t)(ranges_end - cfg.GlyphRanges) * sizeof(ImWchar), hash);
+        }
+        else
+        {
+            hash = ImHashStr("GetGlyphRangesDefault", 0, hash);
+        }
+    }
+    for (int rect_n = 0; rect_n < atlas->CustomRects.Size; rect_n++)
+    {
+        const ImFontAtlas::CustomRect& r = atlas->CustomRects[rect_n];
+        const int font_index = ImFontAtlasFindFontIndex(atlas, r.Font);
+        hash = ImHashData(&r.ID, sizeof(r.ID), hash);
+        hash = ImHashData(&r.Width, sizeof(r.Width), hash);
+        hash = ImHashData(&r.Height, sizeof(r.Height), hash);
+        hash = ImHashData(&r.GlyphAdvanceX, sizeof(r.GlyphAdvanceX), hash);
+        hash = ImHashData(&r.GlyphOffset, sizeof(r.GlyphOffset), hash);
+        hash = ImHashData(&font_index, sizeof(font_index), hash);
+    }
+    return hash;
+}
+
+static void ImFontAtlasCacheWrite(ImVector<unsigned char>* out_data, const void* data, size_t data_size)
+{
+    const int offset = out_data->Size;
+    out_data->resize(offset + (int)data_size);
+    memcpy(out_data->Data + offset, data, data_size);
+}
+
+static bool ImFontAtlasCacheRead(const unsigned char** p, const unsigned char* p_end, void* out_data, size_t data_size)
+{
+    if ((size_t)(p_end - *p) < data_size)
+        return false;
+    memcpy(out_data, *p, data_size);
+    *p += data_size;
+    return true;
+}
+
+bool    ImFontAtlas::SaveCacheToMemory(ImVector<unsigned char>* out_data)
+{
+    out_data->resize(0);
+    if (TexPixelsAlpha8 == NULL || DynamicGlyphs != NULL)
+        return false;
+
+    ImFontAtlasCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    header.Magic = IM_FONT_ATLAS_CACHE_MAGIC;
+    header.Version = IM_FONT_ATLAS_CACHE_VERSION;
+    header.InputsHash = ImFontAtlasCacheCalcInputsHash(this);
+    header.SizeofGlyph = (ImU32)sizeof(ImFontGlyph);
+    header.TexWidth = TexWidth;
+    header.TexHeight = TexHeight;
+    header.TexUvWhitePixel = TexUvWhitePixel;
+    header.CustomRectsCount = CustomRects.Size;
+    header.FontsCount = Fonts.Size;
+    ImFontAtlasCacheWrite(out_data, &header, sizeof(header));
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        ImFontAtlasCacheWrite(out_data, &CustomRects[rect_n].X, sizeof(unsigned short));
+        ImFontAtlasCacheWrite(out_data, &CustomRects[rect_n].Y, sizeof(unsigned short));
+    }
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        const ImFont* font = Fonts[font_n];
+        ImFontAtlasCacheFont font_header;
+        memset(&font_header, 0, sizeof(font_header));
+        font_header.FontSize = font->FontSize;
+        font_header.Ascent = font->Ascent;
+        font_header.Descent = font->Descent;
+        font_header.ConfigDataIndex = font->ConfigData ? (int)(font->ConfigData - ConfigData.Data) : -1;
+        font_header.ConfigDataCount = font->ConfigDataCount;
+        font_header.MetricsTotalSurface = font->MetricsTotalSurface;
+        font_header.GlyphsCount = font->Glyphs.Size;
+        ImFontAtlasCacheWrite(out_data, &font_header, sizeof(font_header));
+        ImFontAtlasCacheWrite(out_data, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+    }
+    ImFontAtlasCacheWrite(out_data, TexPixelsAlpha8, (size_t)(TexWidth * TexHeight));
+    return true;
+}
+
+bool    ImFontAtlas::LoadCacheFromMemory(const void* data, size_t data_size)
+{
+    IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    IM_ASSERT(ConfigData.Size > 0);
+    ImFontAtlasBuildRegisterDefaultCustomRects(this);
+
+    // Validate header and inputs
+    const unsigned char* p = (const unsigned char*)data;
+    const unsigned char* p_end = p + data_size;
+    ImFontAtlasCacheHeader header;
+    if (!ImFontAtlasCacheRead(&p, p_end, &header, sizeof(header)))
+        return false;
+    if (header.Magic != IM_FONT_ATLAS_CACHE_MAGIC || header.Version != IM_FONT_ATLAS_CACHE_VERSION || header.SizeofGlyph != sizeof(ImFontGlyph))
+        return false;
+    if (header.InputsHash != ImFontAtlasCacheCalcInputsHash(this) || header.CustomRectsCount != CustomRects.Size || header.FontsCount != Fonts.Size || (Flags & ImFontAtlasFlags_DynamicGlyphs))
+        return false;
+    if (header.TexWidth <= 0 || header.TexHeight <= 0)
+        return false;
+
+    // Validate the remaining size and the ConfigData[] ranges before modifying anything
+    const size_t custom_rects_size = (size_t)header.CustomRectsCount * sizeof(unsigned short) * 2;
+    if ((size_t)(p_end - p) < custom_rects_size)
+        return false;
+    const unsigned char* p_fonts = p + custom_rects_size;
+    for (int font_n = 0; font_n < header.FontsCount; font_n++)
+    {
+        ImFontAtlasCacheFont font_header;
+        if (!ImFontAtlasCacheRead(&p_fonts, p_end, &font_header, sizeof(font_header)))
+            return false;
+        if (font_header.ConfigDataIndex < -1 || font_header.ConfigDataIndex >= ConfigData.Size || font_header.ConfigDataCount < 0 || font_header.ConfigDataCount > ConfigData.Size - ImMax(font_header.ConfigDataIndex, 0))
+            return false;
+        if (font_header.ConfigDataIndex == -1 && font_header.ConfigDataCount != 0)
+            return false;
+        if (font_header.GlyphsCount < 0 || (size_t)(p_end - p_fonts) < (size_t)font_header.GlyphsCount * sizeof(ImFontGlyph))
+            return false;
+        p_fonts += font_header.GlyphsCount * sizeof(ImFontGlyph);
+    }
+    if ((size_t)(p_end - p_fonts) != (size_t)header.TexWidth * header.TexHeight)
+        return false;
+
+    // Restore the state Build() would have left
+    TexID = TexIDSDF = (ImTextureID)NULL;
+    ClearTexData();
+    TexWidth = header.TexWidth;
+    TexHeight = header.TexHeight;
+    TexUvScale = ImVec2(1.0f / TexWidth, 1.0f / TexHeight);
+    TexUvWhitePixel = header.TexUvWhitePixel;
+    for (int rect_n = 0; rect_n < CustomRects.Size; rect_n++)
+    {
+        ImFontAtlasCacheRead(&p, p_end, &CustomRects[rect_n].X, sizeof(unsigned short));
+        ImFontAtlasCacheRead(&p, p_end, &CustomRects[rect_n].Y, sizeof(unsigned short));
+    }
+    for (int font_n = 0; font_n < Fonts.Size; font_n++)
+    {
+        ImFont* font = Fonts[font_n];
+        ImFontAtlasCacheFont font_header;
+        ImFontAtlasCacheRead(&p, p_end, &font_header, sizeof(font_header));
+        font->ClearOutputData();
+        font->FontSize = font_header.FontSize;
+        font->Ascent = font_header.Ascent;
+        font->Descent = font_header.Descent;
+        font->ConfigData = (font_header.ConfigDataIndex != -1) ? &ConfigData[font_header.ConfigDataIndex] : NULL;
+        font->ConfigDataCount = font_header.ConfigDataCount;
+        font->ContainerAtlas = this;
+        font->Glyphs.resize(font_header.GlyphsCount);
+        ImFontAtlasCacheRead(&p, p_end, font->Glyphs.Data, (size_t)font->Glyphs.size_in_bytes());
+        font->MetricsTotalSurface = font_header.MetricsTotalSurface;
+        font->BuildLookupTable();
+    }
+    TexPixelsAlpha8 = (unsigned char*)ImGui::MemAlloc((size_t)(TexWidth * TexHeight));
+    ImFontAtlasCacheRead(&p, p_end, TexPixelsAlpha8, (size_t)(TexWidth * TexHeight));
+    return true;
+}
+
+bool    ImFontAtlas::BuildWithCacheFile(const char* filename)
+{
+    size_t data_size = 0;
+    if (void* data = ImFileLoadToMemory(filename, "rb", &data_size))
+    {
+        const bool loaded = LoadCacheFromMemory(data, data_size);
+        ImGui::MemFree(data);
+        if (loaded)
+            return true;
+    }
+    if (!Build())
+        return false;
+
+    ImVector<unsigned char> cache_data;
+    if (SaveCacheToMemory(&cache_data))
+        if (FILE* f = ImFileOpen(filename, "wb"))
+        {
+            fwrite(cache_data.Data, 1, (size_t)cache_data.Size, f);
+            fclose(f);
+        }
+    return true;
+}
+
 void    ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_brighten_factor)
 {
     for (unsigned int i = 0; i < 256; i++)
@@ -1753,6 +2402,7 @@ struct ImFontBuildSrcData
     int                 DstIndex;           // Index into atlas->Fonts[] and dst_tmp_array[]
     int                 GlyphsHighest;      // Highest requested codepoint
     int                 GlyphsCount;        // Glyph count (excluding missing glyphs and glyphs already set by an earlier source font)
+    int                 GlyphsDynamicCount; // Glyph count left to be rasterized on demand (ImFontAtlasFlags_DynamicGlyphs)
     ImBoolVector        GlyphsSet;          // Glyph bit map (random access, 1-bit per codepoint. This will be a maximum of 8KB)
     ImVector<int>       GlyphsList;         // Glyph codepoints list (flattened version of GlyphsMap)
 };
@@ -1766,41 +2416,457 @@ struct ImFontBuildDstData
     ImBoolVector        GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
-static void UnpackBoolVectorToFlatIndexList(const ImBoolVector* in, ImVector<int>* out)
+//-----------------------------------------------------------------------------
+// ImFontAtlasFlags_DynamicGlyphs
+//-----------------------------------------------------------------------------
+// Build() only rasterizes U+0000..U+00FF. Other available glyphs are registered in the fonts lookup tables with their advance
+// (so text can be measured) and a 0xFFFE index, which makes ImFont::FindGlyph() call ImFontAtlasDynamicGlyphsLoad().
+// Glyphs are packed with the stb_rectpack context left by Build(). As it can't free individual rectangles, when a glyph doesn't
+// fit we wait for the next NewFrame() (so no glyph submitted in the current frame changes) then restore the packer state left by
+// Build() and pack again the most recently used glyphs, evicting the least recently used ones.
+//-----------------------------------------------------------------------------
+
+struct ImFontDynamicGlyph
 {
-    IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
-    const int* it_begin = in->Storage.begin();
-    const int* it_end = in->Storage.end();
-    for (const int* it = it_begin; it < it_end; it++)
-        if (int entries_32 = *it)
-            for (int bit_n = 0; bit_n < 32; bit_n++)
-                if (entries_32 & (1 << bit_n))
-                    out->push_back((int)((it - it_begin) << 5) + bit_n);
+    int                 FontIndex;          // Index into atlas->Fonts[]
+    int                 SrcIndex;           // Index into atlas->ConfigData[] of the source font providing this glyph
+    int                 Codepoint;
+    int                 GlyphIndex;         // Index into Fonts[FontIndex]->Glyphs[] once rasterized, -1 before. The slot is kept when evicting and reused when loading again.
+    int                 LastUsedFrame;      // Copied from ImFont::GlyphsLastUsedFrame[] when evicting
+    float               AdvanceX;           // Advance registered in ImFont::IndexAdvanceX[] before the glyph is rasterized
+    bool                Loaded;             // Currently rasterized into the texture
+    int                 X, Y, W, H;         // Packed rectangle (including padding) when loaded
+};
+
+struct ImFontAtlasDynamicGlyphs
+{
+    ImVector<stbtt_fontinfo>        FontInfos;          // One per atlas->ConfigData[] (pointing to its FontData)
+    ImVector<ImFontDynamicGlyph>    Glyphs;             // All glyphs rasterized on demand, sorted by FontIndex then Codepoint
+    stbtt_pack_context              PackContext;        // Packer state, pixels = atlas->TexPixelsAlpha8
+    stbrp_context                   PackContextBuilt;   // Copy of the packer state after Build()
+    ImVector<stbrp_node>            PackNodesBuilt;
+    int                             FrameCount;
+    int                             Generation;         // Incremented when glyphs are evicted or moved. Glyph UV copied elsewhere (e.g. ImFontGlyphRunCache) need to be refreshed.
+    bool                            PackFull;           // A glyph didn't fit in the texture this frame
+    int                             LoadedCount, EvictedCount;
+};
+
+static void ImFontAtlasDynamicGlyphsMarkDirty(ImFontAtlas* atlas, int x, int y, int w, int h)
+{
+    ImFontAtlas::DirtyRect r;
+    r.X = (unsigned short)x;
+    r.Y = (unsigned short)y;
+    r.Width = (unsigned short)w;
+    r.Height = (unsigned short)h;
+    atlas->TexDirtyRects.push_back(r);
+
+    // Keep the RGBA32 copy in sync if the back-end uses it
+    if (atlas->TexPixelsRGBA32)
+        for (int j = y; j < y + h; j++)
+        {
+            const unsigned char* src = atlas->TexPixelsAlpha8 + j * atlas->TexWidth + x;
+            unsigned int* dst = atlas->TexPixelsRGBA32 + j * atlas->TexWidth + x;
+            for (int i = 0; i < w; i++)
+                dst[i] = IM_COL32(255, 255, 255, (unsigned int)src[i]);
+        }
 }
 
-bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+static int ImFontAtlasDynamicGlyphsFindFontIndex(ImFontAtlas* atlas, ImFont* font)
 {
-    IM_ASSERT(atlas->ConfigData.Size > 0);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        if (atlas->Fonts[font_n] == font)
+            return font_n;
+    return -1;
+}
 
-    ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
+static ImFontDynamicGlyph* ImFontAtlasDynamicGlyphsFind(ImFontAtlasDynamicGlyphs* dyn, int font_index, int codepoint)
+{
+    ImFontDynamicGlyph* first = dyn->Glyphs.Data;
+    size_t count = (size_t)dyn->Glyphs.Size;
+    while (count > 0)
+    {
+        size_t count2 = count >> 1;
+        ImFontDynamicGlyph* mid = first + count2;
+        if (mid->FontIndex < font_index || (mid->FontIndex == font_index && mid->Codepoint < codepoint))
+        {
+            first = ++mid;
+            count -= count2 + 1;
+        }
+        else
+        {
+            count = count2;
+        }
+    }
+    if (first == dyn->Glyphs.Data + dyn->Glyphs.Size || first->FontIndex != font_index || (codepoint >= 0 && first->Codepoint != codepoint))
+        return NULL;
+    return first;
+}
 
-    // Clear atlas
-    atlas->TexID = (ImTextureID)NULL;
-    atlas->TexWidth = atlas->TexHeight = 0;
-    atlas->TexUvScale = ImVec2(0.0f, 0.0f);
-    atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
-    atlas->ClearTexData();
+static int IMGUI_CDECL ImFontDynamicGlyphComparerByFontAndCodepoint(const void* lhs, const void* rhs)
+{
+    const ImFontDynamicGlyph* a = (const ImFontDynamicGlyph*)lhs;
+    const ImFontDynamicGlyph* b = (const ImFontDynamicGlyph*)rhs;
+    if (a->FontIndex != b->FontIndex)
+        return a->FontIndex - b->FontIndex;
+    return a->Codepoint - b->Codepoint;
+}
 
-    // Temporary storage for building
-    ImVector<ImFontBuildSrcData> src_tmp_array;
-    ImVector<ImFontBuildDstData> dst_tmp_array;
-    src_tmp_array.resize(atlas->ConfigData.Size);
-    dst_tmp_array.resize(atlas->Fonts.Size);
-    memset(src_tmp_array.Data, 0, (size_t)src_tmp_array.size_in_bytes());
-    memset(dst_tmp_array.Data, 0, (size_t)dst_tmp_array.size_in_bytes());
+static int IMGUI_CDECL ImFontDynamicGlyphComparerByLastUsedFrame(const void* lhs, const void* rhs)
+{
+    // Most recently used first
+    const ImFontDynamicGlyph* a = *(const ImFontDynamicGlyph* const*)lhs;
+    const ImFontDynamicGlyph* b = *(const ImFontDynamicGlyph* const*)rhs;
+    return b->LastUsedFrame - a->LastUsedFrame;
+}
 
-    // 1. Initialize font loading structure, check font data validity
-    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+// Take ownership of the packer used by Build() and register the glyphs to rasterize on demand
+static void ImFontAtlasDynamicGlyphsCreate(ImFontAtlas* atlas, stbtt_pack_context* spc, const ImVector<ImFontBuildSrcData>& src_tmp_array, ImVector<ImFontDynamicGlyph>& glyphs)
+{
+    IM_ASSERT(atlas->DynamicGlyphs == NULL);
+    ImFontAtlasDynamicGlyphs* dyn = IM_NEW(ImFontAtlasDynamicGlyphs)();
+    dyn->FrameCount = dyn->Generation = 0;
+    dyn->PackFull = false;
+    dyn->LoadedCount = dyn->EvictedCount = 0;
+
+    // The packer was setup for an infinitely tall texture, restrict it to the final texture then save its state
+    stbrp_context* pack_context = (stbrp_context*)spc->pack_info;
+    pack_context->height = atlas->TexHeight - spc->padding;
+    dyn->PackContext = *spc;
+    dyn->PackContext.height = atlas->TexHeight;
+    dyn->PackContextBuilt = *pack_context;
+    dyn->PackNodesBuilt.resize(pack_context->num_nodes);
+    memcpy(dyn->PackNodesBuilt.Data, spc->nodes, (size_t)dyn->PackNodesBuilt.size_in_bytes());
+
+    dyn->FontInfos.resize(src_tmp_array.Size);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        dyn->FontInfos[src_i] = src_tmp_array[src_i].FontInfo;
+
+    // Calculate advances the same way as Build() + ImFont::AddGlyph() so text can be laid out before glyphs are rasterized
+    for (int glyph_i = 0; glyph_i < glyphs.Size; glyph_i++)
+    {
+        ImFontDynamicGlyph& glyph = glyphs[glyph_i];
+        const ImFontConfig& cfg = atlas->ConfigData[glyph.SrcIndex];
+        const ImFontConfig& dst_cfg = *cfg.DstFont->ConfigData;
+        const stbtt_fontinfo* font_info = &dyn->FontInfos[glyph.SrcIndex];
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+        int advance, lsb;
+        stbtt_GetGlyphHMetrics(font_info, stbtt_FindGlyphIndex(font_info, glyph.Codepoint), &advance, &lsb);
+        glyph.AdvanceX = ImClamp(scale * advance, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX) + dst_cfg.GlyphExtraSpacing.x;
+        if (dst_cfg.PixelSnapH)
+            glyph.AdvanceX = (float)(int)(glyph.AdvanceX + 0.5f);
+    }
+    if (glyphs.Size > 1)
+        ImQsort(glyphs.Data, (size_t)glyphs.Size, sizeof(ImFontDynamicGlyph), ImFontDynamicGlyphComparerByFontAndCodepoint);
+    dyn->Glyphs.swap(glyphs);
+    atlas->DynamicGlyphs = dyn;
+}
+
+static void ImFontAtlasDynamicGlyphsDestroy(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    if (dyn == NULL)
+        return;
+    stbtt_PackEnd(&dyn->PackContext);
+    for (int font_n = 0; font_n < atlas->Fonts.Size; font_n++)
+        atlas->Fonts[font_n]->GlyphsLastUsedFrame.clear();
+    IM_DELETE(dyn);
+    atlas->DynamicGlyphs = NULL;
+    atlas->TexDirtyRects.clear();
+}
+
+// Called by ImFont::BuildLookupTable()
+static void ImFontAtlasDynamicGlyphsBuildLookupTable(ImFontAtlas* atlas, ImFont* font)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    const int font_index = ImFontAtlasDynamicGlyphsFindFontIndex(atlas, font);
+    ImFontDynamicGlyph* glyph = ImFontAtlasDynamicGlyphsFind(dyn, font_index, -1);
+    if (glyph == NULL)
+        return;
+    ImFontDynamicGlyph* glyph_end = dyn->Glyphs.Data + dyn->Glyphs.Size;
+    for (; glyph < glyph_end && glyph->FontIndex == font_index; glyph++)
+    {
+        const int slot = font->GetIndexSlot((unsigned int)glyph->Codepoint);
+        font->IndexLookup[slot] = glyph->Loaded ? (unsigned short)glyph->GlyphIndex : (unsigned short)0xFFFE;
+        font->IndexAdvanceX[slot] = glyph->AdvanceX;
+    }
+}
+
+// Called by ImFont::FindGlyph() on a glyph which isn't rasterized yet. Return NULL if it can't be loaded.
+static const ImFontGlyph* ImFontAtlasDynamicGlyphsLoad(ImFontAtlas* atlas, ImFont* font, ImWchar codepoint)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas ? atlas->DynamicGlyphs : NULL;
+    if (dyn == NULL || dyn->PackFull || atlas->TexPixelsAlpha8 == NULL)
+        return NULL;
+    ImFontDynamicGlyph* glyph = ImFontAtlasDynamicGlyphsFind(dyn, ImFontAtlasDynamicGlyphsFindFontIndex(atlas, font), (int)codepoint);
+    if (glyph == NULL || glyph->Loaded)
+        return NULL;
+
+    // Pack (same as Build())
+    const ImFontConfig& cfg = atlas->ConfigData[glyph->SrcIndex];
+    const stbtt_fontinfo* font_info = &dyn->FontInfos[glyph->SrcIndex];
+    const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(font_info, -cfg.SizePixels);
+    const int padding = atlas->TexGlyphPadding;
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(font_info, stbtt_FindGlyphIndex(font_info, glyph->Codepoint), scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect rect;
+    memset(&rect, 0, sizeof(rect));
+    rect.w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
+    rect.h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+    stbrp_pack_rects((stbrp_context*)dyn->PackContext.pack_info, &rect, 1);
+    if (!rect.was_packed)
+    {
+        dyn->PackFull = true;
+        return NULL;
+    }
+    glyph->X = rect.x;
+    glyph->Y = rect.y;
+    glyph->W = rect.w;
+    glyph->H = rect.h;
+
+    // Rasterize
+    int codepoint_list[1] = { glyph->Codepoint };
+    stbtt_packedchar packed_char;
+    stbtt_pack_range pack_range;
+    memset(&pack_range, 0, sizeof(pack_range));
+    pack_range.font_size = cfg.SizePixels;
+    pack_range.array_of_unicode_codepoints = codepoint_list;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &packed_char;
+    pack_range.h_oversample = (unsigned char)cfg.OversampleH;
+    pack_range.v_oversample = (unsigned char)cfg.OversampleV;
+    dyn->PackContext.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&dyn->PackContext, font_info, &pack_range, 1, &rect);
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+    }
+    ImFontAtlasDynamicGlyphsMarkDirty(atlas, glyph->X, glyph->Y, glyph->W, glyph->H);
+
+    // Register glyph (same as Build())
+    const float font_off_x = cfg.GlyphOffset.x;
+    const float font_off_y = cfg.GlyphOffset.y + (float)(int)(font->Ascent + 0.5f);
+    const float char_advance_x_org = packed_char.xadvance;
+    const float char_advance_x_mod = ImClamp(char_advance_x_org, cfg.GlyphMinAdvanceX, cfg.GlyphMaxAdvanceX);
+    float char_off_x = font_off_x;
+    if (char_advance_x_org != char_advance_x_mod)
+        char_off_x += cfg.PixelSnapH ? (float)(int)((char_advance_x_mod - char_advance_x_org) * 0.5f) : (char_advance_x_mod - char_advance_x_org) * 0.5f;
+    stbtt_aligned_quad q;
+    float dummy_x = 0.0f, dummy_y = 0.0f;
+    stbtt_GetPackedQuad(&packed_char, atlas->TexWidth, atlas->TexHeight, 0, &dummy_x, &dummy_y, &q, 0);
+
+    const int fallback_glyph_index = font->FallbackGlyph ? (int)(font->FallbackGlyph - font->Glyphs.Data) : -1;
+    font->AddGlyph((ImWchar)glyph->Codepoint, q.x0 + char_off_x, q.y0 + font_off_y, q.x1 + char_off_x, q.y1 + font_off_y, q.s0, q.t0, q.s1, q.t1, char_advance_x_mod);
+    if (glyph->GlyphIndex == -1)
+        glyph->GlyphIndex = font->Glyphs.Size - 1;
+    else
+        font->Glyphs[glyph->GlyphIndex] = font->Glyphs.back(), font->Glyphs.pop_back();
+    IM_ASSERT(glyph->GlyphIndex < 0xFFFE); // -1 and -2 are reserved
+    font->DirtyLookupTables = false;
+    font->FallbackGlyph = (fallback_glyph_index != -1) ? &font->Glyphs[fallback_glyph_index] : NULL;
+    font->IndexLookup[font->GetIndexSlot((unsigned int)glyph->Codepoint)] = (unsigned short)glyph->GlyphIndex;
+    font->GlyphsLastUsedFrame.resize(font->Glyphs.Size, 0);
+    font->GlyphsLastUsedFrame[glyph->GlyphIndex] = dyn->FrameCount;
+    glyph->Loaded = true;
+    dyn->LoadedCount++;
+    return &font->Glyphs[glyph->GlyphIndex];
+}
+
+// Called by NewFrame(). If a glyph didn't fit during the previous frame, evict the least recently used glyphs.
+void ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicGlyphs* dyn = atlas->DynamicGlyphs;
+    if (dyn == NULL)
+        return;
+    dyn->FrameCount++;
+    if (!dyn->PackFull || atlas->TexPixelsAlpha8 == NULL)
+        return;
+    dyn->PackFull = false;
+
+    // Sort loaded glyphs from most to least recently used (temporary buffers are released by the next NewFrame())
+    ImFontDynamicGlyph** loaded_glyphs = (ImFontDynamicGlyph**)ImGui::MemAllocFrame((size_t)dyn->Glyphs.Size * sizeof(ImFontDynamicGlyph*));
+    int loaded_glyphs_count = 0;
+    int surface_total = 0;
+    for (int glyph_i = 0; glyph_i < dyn->Glyphs.Size; glyph_i++)
+    {
+        ImFontDynamicGlyph* glyph = &dyn->Glyphs[glyph_i];
+        if (!glyph->Loaded)
+            continue;
+        glyph->LastUsedFrame = atlas->Fonts[glyph->FontIndex]->GlyphsLastUsedFrame[glyph->GlyphIndex];
+        loaded_glyphs[loaded_glyphs_count++] = glyph;
+        surface_total += glyph->W * glyph->H;
+    }
+    ImQsort(loaded_glyphs, (size_t)loaded_glyphs_count, sizeof(ImFontDynamicGlyph*), ImFontDynamicGlyphComparerByLastUsedFrame);
+
+    // Clear all glyphs from the texture (keeping a copy), and restore the packer state left by Build()
+    const int tex_w = atlas->TexWidth;
+    const size_t pixels_size = (size_t)tex_w * atlas->TexHeight;
+    unsigned char* pixels_copy = (unsigned char*)ImGui::MemAllocFrame(pixels_size);
+    memcpy(pixels_copy, atlas->TexPixelsAlpha8, pixels_size);
+    for (int glyph_i = 0; glyph_i < loaded_glyphs_count; glyph_i++)
+    {
+        const ImFontDynamicGlyph* glyph = loaded_glyphs[glyph_i];
+        for (int y = glyph->Y; y < glyph->Y + glyph->H; y++)
+            memset(atlas->TexPixelsAlpha8 + y * tex_w + glyph->X, 0, (size_t)glyph->W);
+    }
+    stbrp_context* pack_context = (stbrp_context*)dyn->PackContext.pack_info;
+    *pack_context = dyn->PackContextBuilt;
+    memcpy(dyn->PackContext.nodes, dyn->PackNodesBuilt.Data, (size_t)dyn->PackNodesBuilt.size_in_bytes());
+
+    // Pack again glyphs used during the last frame, then most recently used ones up to half the previous surface. Evict the others.
+    int surface_kept = 0;
+    for (int glyph_i = 0; glyph_i < loaded_glyphs_count; glyph_i++)
+    {
+        ImFontDynamicGlyph* glyph = loaded_glyphs[glyph_i];
+        ImFont* font = atlas->Fonts[glyph->FontIndex];
+        ImFontGlyph& font_glyph = font->Glyphs[glyph->GlyphIndex];
+        stbrp_rect rect;
+        memset(&rect, 0, sizeof(rect));
+        rect.w = (stbrp_coord)glyph->W;
+        rect.h = (stbrp_coord)glyph->H;
+        if (glyph->LastUsedFrame >= dyn->FrameCount - 1 || surface_kept + glyph->W * glyph->H <= surface_total / 2)
+            stbrp_pack_rects(pack_context, &rect, 1);
+        if (rect.was_packed)
+        {
+            for (int y = 0; y < glyph->H; y++)
+                memcpy(atlas->TexPixelsAlpha8 + (rect.y + y) * tex_w + rect.x, pixels_copy + (glyph->Y + y) * tex_w + glyph->X, (size_t)glyph->W);
+            const ImVec2 uv_offset((rect.x - glyph->X) * atlas->TexUvScale.x, (rect.y - glyph->Y) * atlas->TexUvScale.y);
+            font_glyph.U0 += uv_offset.x;
+            font_glyph.V0 += uv_offset.y;
+            font_glyph.U1 += uv_offset.x;
+            font_glyph.V1 += uv_offset.y;
+            glyph->X = rect.x;
+            glyph->Y = rect.y;
+            surface_kept += glyph->W * glyph->H;
+        }
+        else
+        {
+            font->IndexLookup[font->GetIndexSlot((unsigned int)glyph->Codepoint)] = (unsigned short)0xFFFE;
+            font->MetricsTotalSurface -= (int)((font_glyph.U1 - font_glyph.U0) * atlas->TexWidth + 1.99f) * (int)((font_glyph.V1 - font_glyph.V0) * atlas->TexHeight + 1.99f);
+            glyph->Loaded = false;
+            dyn->EvictedCount++;
+        }
+    }
+    ImFontAtlasDynamicGlyphsMarkDirty(atlas, 0, 0, atlas->TexWidth, atlas->TexHeight);
+    dyn->Generation++;
+}
+
+struct ImFontBuildRenderJob
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and src_tmp_array[]
+    int                 GlyphStart;         // Range of glyphs in src_tmp.GlyphsList[]
+    int                 GlyphCount;
+};
+
+struct ImFontBuildRenderJobs
+{
+    ImFontAtlas*                    Atlas;
+    const stbtt_pack_context*       PackContext;
+    ImFontBuildSrcData*             SrcTmpArray;
+    bool                            Parallel;   // Jobs may run on other threads
+    ImVector<ImFontBuildRenderJob>  Jobs;
+};
+
+// Rasterize a range of glyphs of one source font into their packed rectangles. Only reads shared data, except for the texture pixels inside those rectangles.
+static void ImFontAtlasBuildRenderJob(void* job_data, int job_index)
+{
+    const ImFontBuildRenderJobs* jobs = (const ImFontBuildRenderJobs*)job_data;
+    const ImFontBuildRenderJob& job = jobs->Jobs[job_index];
+    ImFontAtlas* atlas = jobs->Atlas;
+    const ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    const ImFontBuildSrcData& src_tmp = jobs->SrcTmpArray[job.SrcIndex];
+
+    // stbtt_PackFontRangesRenderIntoRects() temporarily modifies the pack context, and allocates through stbtt_fontinfo::userdata (see STBTT_malloc)
+    stbtt_pack_context spc = *jobs->PackContext;
+    stbtt_fontinfo font_info = src_tmp.FontInfo;
+    font_info.userdata = jobs->Parallel ? &font_info : NULL;
+    stbtt_pack_range pack_range = src_tmp.PackRange;
+    pack_range.array_of_unicode_codepoints += job.GlyphStart;
+    pack_range.chardata_for_range += job.GlyphStart;
+    pack_range.num_chars = job.GlyphCount;
+    stbrp_rect* rects = src_tmp.Rects + job.GlyphStart;
+    if (cfg.SignedDistanceField)
+    {
+        // Copy distance fields into their rectangles and output the same data as stbtt_PackFontRangesRenderIntoRects().
+        // Values are 128 on the glyph outline and change by 128/SDFPadding per pixel, increasing inside the glyph.
+        const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&font_info, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&font_info, -cfg.SizePixels);
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++)
+        {
+            const stbrp_rect& r = rects[glyph_i];
+            if (!r.was_packed)
+                continue;
+            const int glyph_index_in_font = stbtt_FindGlyphIndex(&font_info, pack_range.array_of_unicode_codepoints[glyph_i]);
+            int advance, lsb, w = 0, h = 0, x_off = 0, y_off = 0;
+            stbtt_GetGlyphHMetrics(&font_info, glyph_index_in_font, &advance, &lsb);
+            if (unsigned char* sdf = stbtt_GetGlyphSDF(&font_info, scale, glyph_index_in_font, cfg.SDFPadding, 128, 128.0f / cfg.SDFPadding, &w, &h, &x_off, &y_off))
+            {
+                IM_ASSERT(w + atlas->TexGlyphPadding == r.w && h + atlas->TexGlyphPadding == r.h);
+                for (int y = 0; y < h; y++)
+                    memcpy(atlas->TexPixelsAlpha8 + (r.y + atlas->TexGlyphPadding + y) * atlas->TexWidth + r.x + atlas->TexGlyphPadding, sdf + y * w, (size_t)w);
+                stbtt_FreeSDF(sdf, font_info.userdata);
+            }
+            stbtt_packedchar& pc = pack_range.chardata_for_range[glyph_i];
+            pc.x0 = (unsigned short)(r.x + atlas->TexGlyphPadding);
+            pc.y0 = (unsigned short)(r.y + atlas->TexGlyphPadding);
+            pc.x1 = (unsigned short)(pc.x0 + w);
+            pc.y1 = (unsigned short)(pc.y0 + h);
+            pc.xadvance = scale * advance;
+            pc.xoff = (float)x_off;
+            pc.yoff = (float)y_off;
+            pc.xoff2 = (float)(x_off + w);
+            pc.yoff2 = (float)(y_off + h);
+        }
+        return;
+    }
+    stbtt_PackFontRangesRenderIntoRects(&spc, &font_info, &pack_range, 1, rects);
+
+    // Apply multiply operator
+    if (cfg.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+        for (int glyph_i = 0; glyph_i < job.GlyphCount; glyph_i++)
+            if (rects[glyph_i].was_packed)
+                ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rects[glyph_i].x, rects[glyph_i].y, rects[glyph_i].w, rects[glyph_i].h, atlas->TexWidth * 1);
+    }
+}
+
+static void UnpackBoolVectorToFlatIndexList(const ImBoolVector* in, ImVector<int>* out)
+{
+    IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
+    const int* it_begin = in->Storage.begin();
+    const int* it_end = in->Storage.end();
+    for (const int* it = it_begin; it < it_end; it++)
+        if (int entries_32 = *it)
+            for (int bit_n = 0; bit_n < 32; bit_n++)
+                if (entries_32 & (1 << bit_n))
+                    out->push_back((int)((it - it_begin) << 5) + bit_n);
+}
+
+bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
+{
+    IM_ASSERT(atlas->ConfigData.Size > 0);
+
+    ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
+
+    // Clear atlas
+    atlas->TexID = atlas->TexIDSDF = (ImTextureID)NULL;
+    atlas->TexWidth = atlas->TexHeight = 0;
+    atlas->TexUvScale = ImVec2(0.0f, 0.0f);
+    atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
+    atlas->ClearTexData();
+
+    // Temporary storage for building
+    ImVector<ImFontBuildSrcData> src_tmp_array;
+    ImVector<ImFontBuildDstData> dst_tmp_array;
+    src_tmp_array.resize(atlas->ConfigData.Size);
+    dst_tmp_array.resize(atlas->Fonts.Size);
+    memset(src_tmp_array.Data, 0, (size_t)src_tmp_array.size_in_bytes());
+    memset(dst_tmp_array.Data, 0, (size_t)dst_tmp_array.size_in_bytes());
+
+    // 1. Initialize font loading structure, check font data validity
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -1820,6 +2886,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         IM_ASSERT(font_offset >= 0 && "FontData is incorrect, or FontNo cannot be found.");
         if (!stbtt_InitFont(&src_tmp.FontInfo, (unsigned char*)cfg.FontData, font_offset))
             return false;
+        IM_ASSERT(!cfg.SignedDistanceField || cfg.SDFPadding > 0);
+        IM_ASSERT(!cfg.MergeMode || src_i == 0 || cfg.SignedDistanceField == atlas->ConfigData[src_i - 1].SignedDistanceField); // Merged sources need to match the destination font: its glyphs are all drawn with a same texture identifier.
 
         // Measure highest codepoints
         ImFontBuildDstData& dst_tmp = dst_tmp_array[src_tmp.DstIndex];
@@ -1831,6 +2899,9 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 2. For every requested codepoint, check for their presence in the font data, and handle redundancy or overlaps between source fonts to avoid unused glyphs.
+    // With ImFontAtlasFlags_DynamicGlyphs, codepoints above U+00FF are only registered and will be rasterized on demand (except for signed distance field fonts).
+    const bool dynamic_glyphs = (atlas->Flags & ImFontAtlasFlags_DynamicGlyphs) != 0;
+    ImVector<ImFontDynamicGlyph> dynamic_glyphs_list;
     int total_glyphs_count = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
@@ -1842,12 +2913,26 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             dst_tmp.GlyphsSet.Resize(dst_tmp.GlyphsHighest + 1);
 
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
-            for (int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
+            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
             {
                 if (cfg.MergeMode && dst_tmp.GlyphsSet.GetBit(codepoint))   // Don't overwrite existing glyphs. We could make this an option (e.g. MergeOverwrite)
                     continue;
                 if (!stbtt_FindGlyphIndex(&src_tmp.FontInfo, codepoint))    // It is actually in the font?
                     continue;
+                if (dynamic_glyphs && codepoint >= 0x100 && !cfg.SignedDistanceField)
+                {
+                    ImFontDynamicGlyph glyph;
+                    memset(&glyph, 0, sizeof(glyph));
+                    glyph.FontIndex = src_tmp.DstIndex;
+                    glyph.SrcIndex = src_i;
+                    glyph.Codepoint = codepoint;
+                    glyph.GlyphIndex = -1;
+                    dynamic_glyphs_list.push_back(glyph);
+                    src_tmp.GlyphsDynamicCount++;
+                    if (dst_tmp.SrcCount > 1)
+                        dst_tmp.GlyphsSet.SetBit(codepoint, true);
+                    continue;
+                }
 
                 // Add to avail set/counters
                 src_tmp.GlyphsCount++;
@@ -1903,20 +2988,24 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         src_tmp.PackRange.array_of_unicode_codepoints = src_tmp.GlyphsList.Data;
         src_tmp.PackRange.num_chars = src_tmp.GlyphsList.Size;
         src_tmp.PackRange.chardata_for_range = src_tmp.PackedChars;
-        src_tmp.PackRange.h_oversample = (unsigned char)cfg.OversampleH;
-        src_tmp.PackRange.v_oversample = (unsigned char)cfg.OversampleV;
+        src_tmp.PackRange.h_oversample = (unsigned char)(cfg.SignedDistanceField ? 1 : cfg.OversampleH);
+        src_tmp.PackRange.v_oversample = (unsigned char)(cfg.SignedDistanceField ? 1 : cfg.OversampleV);
 
         // Gather the sizes of all rectangles we will need to pack (this loop is based on stbtt_PackFontRangesGatherRects)
+        // Signed distance fields are not oversampled and extend SDFPadding pixels around non-empty glyphs (this matches stbtt_GetGlyphSDF)
         const float scale = (cfg.SizePixels > 0) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, cfg.SizePixels) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -cfg.SizePixels);
         const int padding = atlas->TexGlyphPadding;
+        const int oversample_h = src_tmp.PackRange.h_oversample;
+        const int oversample_v = src_tmp.PackRange.v_oversample;
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
         {
             int x0, y0, x1, y1;
             const int glyph_index_in_font = stbtt_FindGlyphIndex(&src_tmp.FontInfo, src_tmp.GlyphsList[glyph_i]);
             IM_ASSERT(glyph_index_in_font != 0);
-            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * cfg.OversampleH, scale * cfg.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + cfg.OversampleH - 1);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + cfg.OversampleV - 1);
+            stbtt_GetGlyphBitmapBoxSubpixel(&src_tmp.FontInfo, glyph_index_in_font, scale * oversample_h, scale * oversample_v, 0, 0, &x0, &y0, &x1, &y1);
+            const int sdf_padding = (cfg.SignedDistanceField && x0 != x1 && y0 != y1) ? cfg.SDFPadding * 2 : 0;
+            src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + padding + oversample_h - 1 + sdf_padding);
+            src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + padding + oversample_v - 1 + sdf_padding);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
         }
     }
@@ -1928,6 +3017,8 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     atlas->TexHeight = 0;
     if (atlas->TexDesiredWidth > 0)
         atlas->TexWidth = atlas->TexDesiredWidth;
+    else if (dynamic_glyphs)
+        atlas->TexWidth = 1024;
     else
         atlas->TexWidth = (surface_sqrt >= 4096*0.7f) ? 4096 : (surface_sqrt >= 2048*0.7f) ? 2048 : (surface_sqrt >= 1024*0.7f) ? 1024 : 512;
 
@@ -1954,7 +3045,9 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
                 atlas->TexHeight = ImMax(atlas->TexHeight, src_tmp.Rects[glyph_i].y + src_tmp.Rects[glyph_i].h);
     }
 
-    // 7. Allocate texture
+    // 7. Allocate texture (a square texture when glyphs are rasterized on demand, which can't be resized later)
+    if (dynamic_glyphs)
+        atlas->TexHeight = ImMax(atlas->TexHeight, atlas->TexWidth);
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)ImGui::MemAlloc(atlas->TexWidth * atlas->TexHeight);
@@ -1963,37 +3056,40 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     spc.height = atlas->TexHeight;
 
     // 8. Render/rasterize font characters into the texture
+    // Split into jobs of up to GLYPHS_PER_JOB glyphs, which can run in parallel as they write to separate rectangles.
+    const int GLYPHS_PER_JOB = 64;
+    ImFontBuildRenderJobs jobs;
+    jobs.Atlas = atlas;
+    jobs.PackContext = &spc;
+    jobs.SrcTmpArray = src_tmp_array.Data;
+    jobs.Parallel = (atlas->BuildParallelForFunc != NULL);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
-    {
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
-        ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
-            continue;
-
-        stbtt_PackFontRangesRenderIntoRects(&spc, &src_tmp.FontInfo, &src_tmp.PackRange, 1, src_tmp.Rects);
-
-        // Apply multiply operator
-        if (cfg.RasterizerMultiply != 1.0f)
+        for (int glyph_i = 0; glyph_i < src_tmp_array[src_i].GlyphsCount; glyph_i += GLYPHS_PER_JOB)
         {
-            unsigned char multiply_table[256];
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-            stbrp_rect* r = &src_tmp.Rects[0];
-            for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++, r++)
-                if (r->was_packed)
-                    ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, r->x, r->y, r->w, r->h, atlas->TexWidth * 1);
+            ImFontBuildRenderJob job;
+            job.SrcIndex = src_i;
+            job.GlyphStart = glyph_i;
+            job.GlyphCount = ImMin(GLYPHS_PER_JOB, src_tmp_array[src_i].GlyphsCount - glyph_i);
+            jobs.Jobs.push_back(job);
         }
-        src_tmp.Rects = NULL;
-    }
+    if (jobs.Parallel && jobs.Jobs.Size > 1)
+        atlas->BuildParallelForFunc(ImFontAtlasBuildRenderJob, &jobs, jobs.Jobs.Size, atlas->BuildParallelForUserData);
+    else
+        for (int job_i = 0; job_i < jobs.Jobs.Size; job_i++)
+            ImFontAtlasBuildRenderJob(&jobs, job_i);
+    for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        src_tmp_array[src_i].Rects = NULL;
 
-    // End packing
-    stbtt_PackEnd(&spc);
+    // End packing (the packer is kept for ImFontAtlasFlags_DynamicGlyphs)
+    if (!dynamic_glyphs)
+        stbtt_PackEnd(&spc);
     buf_rects.clear();
 
     // 9. Setup ImFont and glyphs for runtime
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcData& src_tmp = src_tmp_array[src_i];
-        if (src_tmp.GlyphsCount == 0)
+        if (src_tmp.GlyphsCount == 0 && src_tmp.GlyphsDynamicCount == 0)
             continue;
 
         ImFontConfig& cfg = atlas->ConfigData[src_i];
@@ -2028,6 +3124,9 @@ bool    ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         }
     }
 
+    if (dynamic_glyphs)
+        ImFontAtlasDynamicGlyphsCreate(atlas, &spc, src_tmp_array, dynamic_glyphs_list);
+
     // Cleanup temporary (ImVector doesn't honor destructor)
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
         src_tmp_array[src_i].~ImFontBuildSrcData();
@@ -2357,7 +3456,7 @@ void ImFontGlyphRangesBuilder::AddText(const char* text, const char* text_end)
         text += c_len;
         if (c_len == 0)
             break;
-        if (c < 0x10000)
+        if (c <= IM_UNICODE_CODEPOINT_MAX)
             AddChar((ImWchar)c);
     }
 }
@@ -2365,17 +3464,17 @@ void ImFontGlyphRangesBuilder::AddText(const char* text, const char* text_end)
 void ImFontGlyphRangesBuilder::AddRanges(const ImWchar* ranges)
 {
     for (; ranges[0]; ranges += 2)
-        for (ImWchar c = ranges[0]; c <= ranges[1]; c++)
-            AddChar(c);
+        for (unsigned int c = ranges[0]; c <= ranges[1]; c++)
+            AddChar((ImWchar)c);
 }
 
 void ImFontGlyphRangesBuilder::BuildRanges(ImVector<ImWchar>* out_ranges)
 {
-    for (int n = 0; n < 0x10000; n++)
+    for (int n = 0; n <= IM_UNICODE_CODEPOINT_MAX; n++)
         if (GetBit(n))
         {
             out_ranges->push_back((ImWchar)n);
-            while (n < 0x10000 && GetBit(n + 1))
+            while (n < IM_UNICODE_CODEPOINT_MAX && GetBit(n + 1))
                 n++;
             out_ranges->push_back((ImWchar)n);
         }
@@ -2413,6 +3512,8 @@ void    ImFont::ClearOutputData()
     Glyphs.clear();
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
+    GlyphsLastUsedFrame.clear();
     FallbackGlyph = NULL;
     FallbackAdvanceX = 0.0f;
     ConfigDataCount = 0;
@@ -2421,6 +3522,7 @@ void    ImFont::ClearOutputData()
     Ascent = Descent = 0.0f;
     DirtyLookupTables = true;
     MetricsTotalSurface = 0;
+    MetricsText.Clear();
 }
 
 void ImFont::BuildLookupTable()
@@ -2429,17 +3531,20 @@ void ImFont::BuildLookupTable()
     for (int i = 0; i != Glyphs.Size; i++)
         max_codepoint = ImMax(max_codepoint, (int)Glyphs[i].Codepoint);
 
-    IM_ASSERT(Glyphs.Size < 0xFFFF); // -1 is reserved
+    IM_ASSERT(Glyphs.Size < 0xFFFE); // 0xFFFF and 0xFFFE are reserved
     IndexAdvanceX.clear();
     IndexLookup.clear();
+    IndexPages.clear();
     DirtyLookupTables = false;
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
-        int codepoint = (int)Glyphs[i].Codepoint;
-        IndexAdvanceX[codepoint] = Glyphs[i].AdvanceX;
-        IndexLookup[codepoint] = (ImWchar)i;
+        const int slot = GetIndexSlot(Glyphs[i].Codepoint);
+        IndexAdvanceX[slot] = Glyphs[i].AdvanceX;
+        IndexLookup[slot] = (unsigned short)i;
     }
+    if (ContainerAtlas && ContainerAtlas->DynamicGlyphs)
+        ImFontAtlasDynamicGlyphsBuildLookupTable(ContainerAtlas, this);
 
     // Create a glyph to handle TAB
     // FIXME: Needs proper TAB handling but it needs to be contextualized (or we could arbitrary say that each string starts at "column 0" ?)
@@ -2451,15 +3556,18 @@ void ImFont::BuildLookupTable()
         tab_glyph = *FindGlyph((ImWchar)' ');
         tab_glyph.Codepoint = '\t';
         tab_glyph.AdvanceX *= 4;
-        IndexAdvanceX[(int)tab_glyph.Codepoint] = (float)tab_glyph.AdvanceX;
-        IndexLookup[(int)tab_glyph.Codepoint] = (ImWchar)(Glyphs.Size-1);
+        const int slot = GetIndexSlot(tab_glyph.Codepoint);
+        IndexAdvanceX[slot] = (float)tab_glyph.AdvanceX;
+        IndexLookup[slot] = (unsigned short)(Glyphs.Size-1);
     }
 
     FallbackGlyph = FindGlyphNoFallback(FallbackChar);
     FallbackAdvanceX = FallbackGlyph ? FallbackGlyph->AdvanceX : 0.0f;
-    for (int i = 0; i < max_codepoint + 1; i++)
+    for (int i = 0; i < IndexAdvanceX.Size; i++) // Including the shared empty page, which pages allocated later are copied from
         if (IndexAdvanceX[i] < 0.0f)
             IndexAdvanceX[i] = FallbackAdvanceX;
+    if (ContainerAtlas && ContainerAtlas->DynamicGlyphs)
+        GlyphsLastUsedFrame.resize(Glyphs.Size, 0);
 }
 
 void ImFont::SetFallbackChar(ImWchar c)
@@ -2468,13 +3576,47 @@ void ImFont::SetFallbackChar(ImWchar c)
     BuildLookupTable();
 }
 
+// The index is split in pages of 256 code-points, so sparse sets (e.g. a few CJK or emoji ranges merged into a Latin font) don't
+// pay for a table covering every code-point up to the highest one. IndexPages[] has one entry per 256 code-points up to the highest
+// one, pointing to page 0 (the shared empty page) until a code-point of the page is written to with GetIndexSlot().
 void ImFont::GrowIndex(int new_size)
 {
     IM_ASSERT(IndexAdvanceX.Size == IndexLookup.Size);
-    if (new_size <= IndexLookup.Size)
-        return;
-    IndexAdvanceX.resize(new_size, -1.0f);
-    IndexLookup.resize(new_size, (ImWchar)-1);
+    if (IndexLookup.Size == 0)
+    {
+        IndexAdvanceX.resize(256, -1.0f);
+        IndexLookup.resize(256, (unsigned short)0xFFFF);
+    }
+    const int pages_count = (new_size + 255) >> 8;
+    if (pages_count > IndexPages.Size)
+        IndexPages.resize(pages_count, (unsigned short)0);
+}
+
+int ImFont::GetIndexSlot(unsigned int c)
+{
+    IM_ASSERT(c <= IM_UNICODE_CODEPOINT_MAX);
+    GrowIndex((int)c + 1);
+    unsigned int page = IndexPages.Data[c >> 8];
+    if (page == 0)
+    {
+        // Allocate the page as a copy of the empty page (missing glyphs, with the fallback advance once BuildLookupTable() is done)
+        page = (unsigned int)(IndexLookup.Size >> 8);
+        IndexPages.Data[c >> 8] = (unsigned short)page;
+        IndexAdvanceX.resize(IndexAdvanceX.Size + 256);
+        IndexLookup.resize(IndexLookup.Size + 256);
+        memcpy(IndexAdvanceX.Data + (page << 8), IndexAdvanceX.Data, 256 * sizeof(float));
+        memcpy(IndexLookup.Data + (page << 8), IndexLookup.Data, 256 * sizeof(unsigned short));
+    }
+    return (int)((page << 8) | (c & 0xFF));
+}
+
+bool ImFont::IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last) const
+{
+    // Only test pages, which are allocated when one of their code-points is given a glyph or an advance
+    for (unsigned int page = c_begin >> 8; page <= (c_last >> 8) && page < (unsigned int)IndexPages.Size; page++)
+        if (IndexPages.Data[page] != 0)
+            return false;
+    return true;
 }
 
 // x0/y0/x1/y1 are offset from the character upper-left layout position, in pixels. Therefore x0/y0 are often fairly close to zero.
@@ -2505,38 +3647,112 @@ void ImFont::AddGlyph(ImWchar codepoint, float x0, float y0, float x1, float y1,
 void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
 {
     IM_ASSERT(IndexLookup.Size > 0);    // Currently this can only be called AFTER the font has been built, aka after calling ImFontAtlas::GetTexDataAs*() function.
-    int index_size = IndexLookup.Size;
+    unsigned int index_size = (unsigned int)IndexPages.Size << 8;
 
-    if (dst < index_size && IndexLookup.Data[dst] == (ImWchar)-1 && !overwrite_dst) // 'dst' already exists
+    if (dst < index_size && IndexLookup.Data[((unsigned int)IndexPages.Data[dst >> 8] << 8) | (dst & 0xFF)] == 0xFFFF && !overwrite_dst) // 'dst' already exists
         return;
     if (src >= index_size && dst >= index_size) // both 'dst' and 'src' don't exist -> no-op
         return;
 
-    GrowIndex(dst + 1);
-    IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
-    IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    const unsigned short src_index = (src < index_size) ? IndexLookup.Data[((unsigned int)IndexPages.Data[src >> 8] << 8) | (src & 0xFF)] : (unsigned short)0xFFFF;
+    const float src_advance_x = (src < index_size) ? GetCharAdvance(src) : 1.0f;
+    const int slot = GetIndexSlot(dst);
+    IndexLookup[slot] = src_index;
+    IndexAdvanceX[slot] = src_advance_x;
 }
 
+// With ImFontAtlasFlags_DynamicGlyphs, an index of 0xFFFE means the glyph is available but not rasterized yet.
+// Loading a glyph may reallocate Glyphs[], so don't hold on the returned pointer across calls.
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
+    if (((unsigned int)c >> 8) >= (unsigned int)IndexPages.Size)
         return FallbackGlyph;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    const unsigned short i = IndexLookup.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)];
+    if (i >= 0xFFFE)
+    {
+        if (i == 0xFFFE)
+            if (const ImFontGlyph* glyph = ImFontAtlasDynamicGlyphsLoad(ContainerAtlas, (ImFont*)this, c))
+                return glyph;
         return FallbackGlyph;
+    }
+    if (i < GlyphsLastUsedFrame.Size)
+        ((ImFont*)this)->GlyphsLastUsedFrame.Data[i] = ContainerAtlas->DynamicGlyphs->FrameCount;
     return &Glyphs.Data[i];
 }
 
 const ImFontGlyph* ImFont::FindGlyphNoFallback(ImWchar c) const
 {
-    if (c >= IndexLookup.Size)
-        return NULL;
-    const ImWchar i = IndexLookup.Data[c];
-    if (i == (ImWchar)-1)
+    if (((unsigned int)c >> 8) >= (unsigned int)IndexPages.Size)
         return NULL;
+    const unsigned short i = IndexLookup.Data[((unsigned int)IndexPages.Data[c >> 8] << 8) | (c & 0xFF)];
+    if (i >= 0xFFFE)
+        return (i == 0xFFFE) ? ImFontAtlasDynamicGlyphsLoad(ContainerAtlas, (ImFont*)this, c) : NULL;
+    if (i < GlyphsLastUsedFrame.Size)
+        ((ImFont*)this)->GlyphsLastUsedFrame.Data[i] = ContainerAtlas->DynamicGlyphs->FrameCount;
     return &Glyphs.Data[i];
 }
 
+// Consecutive characters of a text typically share their index page, which is only looked up once per run.
+// Glyphs which aren't rasterized yet (ImFontAtlasFlags_DynamicGlyphs) are loaded first, as this may reallocate Glyphs[].
+// When 'glyphs_to_load' is set the font isn't modified (see ImDrawListSharedData::GlyphsToLoad): those glyphs are output as the fallback
+// glyph and added to the list, as are glyphs whose last used frame needs to be refreshed, for the main thread to call FindGlyph() on them.
+static void ImFontFindGlyphs(const ImFont* font, const ImWchar* chars, int count, const ImFontGlyph** out_glyphs, ImVector<ImFontGlyphToLoad>* glyphs_to_load)
+{
+    const unsigned int pages_count = (unsigned int)font->IndexPages.Size;
+    ImFontAtlasDynamicGlyphs* dyn = font->ContainerAtlas ? font->ContainerAtlas->DynamicGlyphs : NULL;
+    if (dyn && !glyphs_to_load)
+        for (int n = 0; n < count; n++)
+        {
+            const unsigned int c = chars[n];
+            if ((c >> 8) < pages_count && font->IndexLookup.Data[((unsigned int)font->IndexPages.Data[c >> 8] << 8) | (c & 0xFF)] == 0xFFFE)
+                ImFontAtlasDynamicGlyphsLoad(font->ContainerAtlas, (ImFont*)font, (ImWchar)c);
+        }
+
+    const ImFontGlyph* glyphs = font->Glyphs.Data;
+    int* glyphs_last_used_frame = ((ImFont*)font)->GlyphsLastUsedFrame.Data;
+    const int glyphs_last_used_frame_count = font->GlyphsLastUsedFrame.Size;
+    unsigned int page_n = (unsigned int)-1;
+    const unsigned short* page = NULL;
+    for (int n = 0; n < count; n++)
+    {
+        const unsigned int c = chars[n];
+        if ((c >> 8) != page_n)
+        {
+            page_n = c >> 8;
+            page = (page_n < pages_count) ? font->IndexLookup.Data + ((unsigned int)font->IndexPages.Data[page_n] << 8) : NULL;
+        }
+        const unsigned short i = page ? page[c & 0xFF] : (unsigned short)0xFFFF;
+        if (i >= 0xFFFE)
+        {
+            if (i == 0xFFFE && glyphs_to_load)
+            {
+                ImFontGlyphToLoad req = { (ImFont*)font, (ImWchar)c };
+                glyphs_to_load->push_back(req);
+            }
+            out_glyphs[n] = font->FallbackGlyph;
+            continue;
+        }
+        if (i < glyphs_last_used_frame_count && glyphs_last_used_frame[i] != dyn->FrameCount)
+        {
+            if (glyphs_to_load)
+            {
+                ImFontGlyphToLoad req = { (ImFont*)font, (ImWchar)c };
+                glyphs_to_load->push_back(req);
+            }
+            else
+            {
+                glyphs_last_used_frame[i] = dyn->FrameCount;
+            }
+        }
+        out_glyphs[n] = &glyphs[i];
+    }
+}
+
+void ImFont::FindGlyphs(const ImWchar* chars, int count, const ImFontGlyph** out_glyphs) const
+{
+    ImFontFindGlyphs(this, chars, count, out_glyphs, NULL);
+}
+
 const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width) const
 {
     // Simple word-wrapping for English, not full-featured. Please submit failing cases!
@@ -2591,7 +3807,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX);
+        const float char_width = GetCharAdvance(c);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -2636,6 +3852,214 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+// Word-wrap the whole text in a single pass, recording the line breaks and widths which CalcTextSizeA() and RenderText() would compute.
+// This runs the same scanner as CalcWordWrapPositionA() but doesn't scan each line twice (once to find the break, once to measure or render it):
+// only the characters of a word cut by a line break are scanned again. Widths are accumulated in the same order as CalcTextSizeA() so results are identical.
+// Character positions are output as they are scanned, and the ones past a line break are removed as the scan starts again from there.
+ImVec2 ImFont::CalcWordWrapLayoutA(float size, float wrap_width, const char* text_begin, const char* text_end, ImVector<ImFontWrapLine>* out_lines, ImVector<ImFontWrapGlyph>* out_glyphs) const
+{
+    IM_ASSERT(wrap_width > 0.0f);
+    if (!text_end)
+        text_end = text_begin + strlen(text_begin);
+
+    const float line_height = size;
+    const float scale = size / FontSize;
+    const float wrap_width_unscaled = wrap_width / scale;
+
+    ImVec2 text_size = ImVec2(0,0);
+    ImFontWrapLine line;
+    ImFontWrapGlyph glyph;
+    line.GlyphsBegin = line.GlyphsEnd = out_glyphs ? out_glyphs->Size : 0;
+    const char* s = text_begin;
+    for (;;)
+    {
+        // Start a new scan, as CalcTextSizeA() would call CalcWordWrapPositionA() from this point.
+        // Unscaled widths are used to find the break, same as CalcWordWrapPositionA(). 'x' is the scaled width of the current line.
+        const char* scan_begin = s;
+        const char* line_begin = s;
+        const char* word_end = s;
+        const char* prev_word_end = NULL;
+        const char* wrap_pos = NULL;
+        float line_width = 0.0f, word_width = 0.0f, blank_width = 0.0f;
+        float x = 0.0f, word_end_x = 0.0f, prev_word_end_x = 0.0f, wrap_x = 0.0f;
+        bool inside_word = true;
+        while (s < text_end)
+        {
+            unsigned int c = (unsigned int)*s;
+            const char* next_s;
+            if (c < 0x80)
+                next_s = s + 1;
+            else
+                next_s = s + ImTextCharFromUtf8(&c, s, text_end);
+            if (c == 0)
+            {
+                wrap_pos = s;
+                wrap_x = x;
+                break;
+            }
+
+            if (c < 32)
+            {
+                if (c == '\n')
+                {
+                    line.TextBegin = (int)(line_begin - text_begin);
+                    line.TextEnd = (int)(s - text_begin);
+                    line.Width = x;
+                    line.GlyphsEnd = out_glyphs ? out_glyphs->Size : 0;
+                    out_lines->push_back(line);
+                    line.GlyphsBegin = line.GlyphsEnd;
+                    text_size.x = ImMax(text_size.x, x);
+                    text_size.y += line_height;
+                    line_begin = word_end = s = next_s;
+                    prev_word_end = NULL;
+                    line_width = word_width = blank_width = 0.0f;
+                    x = word_end_x = prev_word_end_x = 0.0f;
+                    inside_word = true;
+                    continue;
+                }
+                if (c == '\r')
+                {
+                    s = next_s;
+                    continue;
+                }
+            }
+
+            const float char_width = GetCharAdvance(c);
+            if (ImCharIsBlankW(c))
+            {
+                if (inside_word)
+                {
+                    line_width += blank_width;
+                    blank_width = 0.0f;
+                    word_end = s;
+                    word_end_x = x;
+                }
+                blank_width += char_width;
+                inside_word = false;
+            }
+            else
+            {
+                word_width += char_width;
+                if (inside_word)
+                {
+                    word_end = next_s;
+                    word_end_x = x + char_width * scale;
+                }
+                else
+                {
+                    prev_word_end = word_end;
+                    prev_word_end_x = word_end_x;
+                    line_width += word_width + blank_width;
+                    word_width = blank_width = 0.0f;
+                }
+                inside_word = !(c == '.' || c == ',' || c == ';' || c == '!' || c == '?' || c == '\"');
+            }
+
+            if (line_width + word_width >= wrap_width_unscaled)
+            {
+                if (word_width < wrap_width_unscaled)
+                {
+                    wrap_pos = prev_word_end ? prev_word_end : word_end;
+                    wrap_x = prev_word_end ? prev_word_end_x : word_end_x;
+                }
+                else
+                {
+                    wrap_pos = s;
+                    wrap_x = x;
+                }
+                break;
+            }
+
+            if (out_glyphs)
+            {
+                glyph.TextOffset = (int)(s - text_begin);
+                glyph.Codepoint = (ImWchar)c;
+                glyph.X = x;
+                out_glyphs->push_back(glyph);
+            }
+            x += char_width * scale;
+            s = next_s;
+        }
+
+        // Reached the end of the text: the last line is only counted if it isn't empty
+        if (wrap_pos == NULL)
+        {
+            if (x > 0.0f || text_size.y == 0.0f)
+            {
+                line.TextBegin = (int)(line_begin - text_begin);
+                line.TextEnd = (int)(text_end - text_begin);
+                line.Width = x;
+                line.GlyphsEnd = out_glyphs ? out_glyphs->Size : 0;
+                out_lines->push_back(line);
+                text_size.x = ImMax(text_size.x, x);
+                text_size.y += line_height;
+            }
+            break;
+        }
+
+        // Remove the characters scanned past the line break
+        if (out_glyphs)
+        {
+            const int wrap_offset = (int)(wrap_pos - text_begin);
+            while (out_glyphs->Size > line.GlyphsBegin && out_glyphs->back().TextOffset >= wrap_offset)
+                out_glyphs->pop_back();
+        }
+
+        // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
+        // (when the break happens right after a '\n' character CalcTextSizeA() outputs an empty line first, then starts a new scan)
+        if (wrap_pos == scan_begin)
+        {
+            unsigned int c = (unsigned int)*wrap_pos;
+            if (c < 0x80)
+            {
+                wrap_pos += 1;
+            }
+            else
+            {
+                wrap_pos += ImTextCharFromUtf8(&c, wrap_pos, text_end);
+                if (c == 0) // Malformed UTF-8?
+                {
+                    if (text_size.y == 0.0f)
+                    {
+                        line.TextBegin = line.TextEnd = (int)(scan_begin - text_begin);
+                        line.Width = 0.0f;
+                        line.GlyphsEnd = line.GlyphsBegin;
+                        out_lines->push_back(line);
+                        text_size.y += line_height;
+                    }
+                    break;
+                }
+            }
+            wrap_x = (c == '\n' || c == '\r') ? 0.0f : GetCharAdvance(c) * scale;
+            if (out_glyphs && wrap_x != 0.0f)
+            {
+                glyph.TextOffset = (int)(scan_begin - text_begin);
+                glyph.Codepoint = (ImWchar)c;
+                glyph.X = 0.0f;
+                out_glyphs->push_back(glyph);
+            }
+        }
+        line.TextBegin = (int)(line_begin - text_begin);
+        line.TextEnd = (int)(wrap_pos - text_begin);
+        line.Width = wrap_x;
+        line.GlyphsEnd = out_glyphs ? out_glyphs->Size : 0;
+        out_lines->push_back(line);
+        line.GlyphsBegin = line.GlyphsEnd;
+        text_size.x = ImMax(text_size.x, wrap_x);
+        text_size.y += line_height;
+
+        // Wrapping skips upcoming blanks
+        s = wrap_pos;
+        while (s < text_end)
+        {
+            const char c = *s;
+            if (ImCharIsBlankA(c)) { s++; } else if (c == '\n') { s++; break; } else { break; }
+        }
+    }
+
+    return text_size;
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
@@ -2708,7 +4132,7 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
                 continue;
         }
 
-        const float char_width = ((int)c < IndexAdvanceX.Size ? IndexAdvanceX.Data[c] : FallbackAdvanceX) * scale;
+        const float char_width = GetCharAdvance(c) * scale;
         if (line_width + char_width >= max_width)
         {
             s = prev_s;
@@ -2734,7 +4158,9 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
 {
     if (c == ' ' || c == '\t' || c == '\n' || c == '\r') // Match behavior of RenderText(), those 4 codepoints are hard-coded.
         return;
-    if (const ImFontGlyph* glyph = FindGlyph(c))
+    const ImFontGlyph* glyph = NULL;
+    ImFontFindGlyphs(this, &c, 1, &glyph, draw_list->_Data->GlyphsToLoad);
+    if (glyph)
     {
         float scale = (size >= 0.0f) ? (size / FontSize) : 1.0f;
         pos.x = (float)(int)pos.x + DisplayOffset.x;
@@ -2749,6 +4175,14 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // ImGui functions generally already provides a valid text_end, so this is merely to handle direct calls.
 
+    ImDrawTextStats* stats = draw_list->_GetTextStats(this);
+    stats->TextCount++;
+
+    // Emit from the glyph-run cache if available (see io.ConfigTextGlyphRunCache)
+    if (ImFontGlyphRunCache* glyph_run_cache = draw_list->_Data ? draw_list->_Data->GlyphRunCache : NULL)
+        if (glyph_run_cache->RenderText(draw_list, this, size, pos, col, clip_rect, text_begin, text_end, wrap_width, cpu_fine_clip))
+            return;
+
     // Align to be pixel perfect
     pos.x = (float)(int)pos.x + DisplayOffset.x;
     pos.y = (float)(int)pos.y + DisplayOffset.y;
@@ -2764,6 +4198,26 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
 
     // Fast-forward to first visible line
     const char* s = text_begin;
+    const ImFontWrapLine* wrap_line = NULL;
+    if (ImFontWrapLayoutCache* wrap_layout_cache = (word_wrap_enabled && draw_list->_Data) ? draw_list->_Data->WrapLayoutCache : NULL)
+    {
+        // Use cached line breaks (see io.ConfigTextWrapLayoutCache): only process the lines within the clipping rectangle
+        const ImFontWrapLayout* layout = wrap_layout_cache->GetLayout(this, size, wrap_width, text_begin, text_end, false);
+        wrap_line = wrap_layout_cache->Lines.Data + layout->LinesOffset;
+        const ImFontWrapLine* wrap_line_end = wrap_line + layout->LinesCount;
+        while (wrap_line < wrap_line_end && y + line_height < clip_rect.y)
+        {
+            wrap_line++;
+            y += line_height;
+        }
+        if (wrap_line == wrap_line_end)
+            return;
+        const ImFontWrapLine* wrap_line_last = wrap_line;
+        for (float y_end = y + line_height; wrap_line_last + 1 < wrap_line_end && y_end <= clip_rect.w; y_end += line_height)
+            wrap_line_last++;
+        s = text_begin + wrap_line->TextBegin;
+        text_end = text_begin + wrap_line_last->TextEnd;
+    }
     if (y + line_height < clip_rect.y && !word_wrap_enabled)
         while (y + line_height < clip_rect.y && s < text_end)
         {
@@ -2798,13 +4252,28 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
     ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
     unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const unsigned int vtx_current_idx_begin = vtx_current_idx;
+    int glyphs_clipped = 0;
+
+    // Characters are decoded and their glyphs looked up in batches ahead of 's', see FindGlyphs()
+    const int BATCH_SIZE = 64;
+    ImWchar batch_chars[BATCH_SIZE];
+    const char* batch_ends[BATCH_SIZE];
+    const ImFontGlyph* batch_glyphs[BATCH_SIZE];
+    int batch_n = 0, batch_count = 0;
 
     while (s < text_end)
     {
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
-            if (!word_wrap_eol)
+            if (wrap_line && !word_wrap_eol)
+            {
+                s = text_begin + wrap_line->TextBegin;
+                word_wrap_eol = text_begin + wrap_line->TextEnd;
+                wrap_line++;
+            }
+            else if (!word_wrap_eol)
             {
                 word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - pos.x));
                 if (word_wrap_eol == s) // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
@@ -2827,18 +4296,35 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
             }
         }
 
-        // Decode and advance source
-        unsigned int c = (unsigned int)*s;
-        if (c < 0x80)
+        // Decode and advance source. Refill the batch when exhausted or when wrapping skipped characters.
+        if (batch_n == batch_count || batch_ends[batch_n - 1] != s)
         {
-            s += 1;
-        }
-        else
-        {
-            s += ImTextCharFromUtf8(&c, s, text_end);
-            if (c == 0) // Malformed UTF-8?
+            batch_n = batch_count = 0;
+            for (const char* p = s; p < text_end && batch_count < BATCH_SIZE; )
+            {
+                unsigned int c = (unsigned int)*p;
+                if (c < 0x80)
+                {
+                    p += 1;
+                }
+                else
+                {
+                    p += ImTextCharFromUtf8(&c, p, text_end);
+                    if (c == 0) // Malformed UTF-8? Stop the batch before this character
+                        break;
+                    if (c > IM_UNICODE_CODEPOINT_MAX)
+                        c = 0xFFFD;
+                }
+                batch_chars[batch_count] = (ImWchar)c;
+                batch_ends[batch_count++] = p;
+            }
+            if (batch_count == 0)
                 break;
+            ImFontFindGlyphs(this, batch_chars, batch_count, batch_glyphs, draw_list->_Data->GlyphsToLoad);
         }
+        const unsigned int c = batch_chars[batch_n];
+        const ImFontGlyph* glyph = batch_glyphs[batch_n];
+        s = batch_ends[batch_n++];
 
         if (c < 32)
         {
@@ -2855,7 +4341,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
         }
 
         float char_width = 0.0f;
-        if (const ImFontGlyph* glyph = FindGlyph((ImWchar)c))
+        if (glyph)
         {
             char_width = glyph->AdvanceX * scale;
 
@@ -2900,6 +4386,7 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                         }
                         if (y1 >= y2)
                         {
+                            glyphs_clipped++;
                             x += char_width;
                             continue;
                         }
@@ -2918,11 +4405,304 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
                         idx_write += 6;
                     }
                 }
+                else
+                {
+                    glyphs_clipped++;
+                }
             }
         }
 
         x += char_width;
     }
+    stats->GlyphCount += (int)(vtx_current_idx - vtx_current_idx_begin) / 4;
+    stats->GlyphClippedCount += glyphs_clipped;
+    stats->VtxCount += (int)(vtx_current_idx - vtx_current_idx_begin);
+
+    // Give back unused vertices
+    draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
+    draw_list->IdxBuffer.resize((int)(idx_write - draw_list->IdxBuffer.Data));
+    draw_list->CmdBuffer[draw_list->CmdBuffer.Size-1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size - draw_list->_VtxCurrentOffset;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImFontGlyphRunCache
+//-----------------------------------------------------------------------------
+
+void ImFontGlyphRunCache::Clear()
+{
+    Map.Clear();
+    Runs.clear();
+    TextBuf.clear();
+    Quads.clear();
+    TempDrawList.ClearFreeMemory();
+    LastRunIdx = -1;
+}
+
+// Called by NewFrame() when io.ConfigTextGlyphRunCache is enabled
+void ImFontGlyphRunCache::NewFrame(const ImFontAtlas* atlas)
+{
+    FrameCount++;
+    HitCountPrev = HitCount;
+    MissCountPrev = MissCount;
+    HitCount = MissCount = 0;
+
+    // Recorded UV are invalid if the atlas has been rebuilt, or if glyphs have been evicted/moved (ImFontAtlasFlags_DynamicGlyphs)
+    const int tex_glyphs_generation = atlas->DynamicGlyphs ? atlas->DynamicGlyphs->Generation : 0;
+    if (TexID != atlas->TexID || TexUvWhitePixel.x != atlas->TexUvWhitePixel.x || TexUvWhitePixel.y != atlas->TexUvWhitePixel.y || TexGlyphsGeneration != tex_glyphs_generation)
+    {
+        Clear();
+        TexID = atlas->TexID;
+        TexUvWhitePixel = atlas->TexUvWhitePixel;
+        TexGlyphsGeneration = tex_glyphs_generation;
+        LastGcFrame = FrameCount;
+        return;
+    }
+
+    // Compact storage, discarding runs which haven't been used recently.
+    // Texts are appended when runs are added so TextBuf[] is in the order of Runs[], but quads are appended when runs are rendered on a following frame:
+    // copy the quads we keep to a new buffer.
+    if (FrameCount - LastGcFrame < GcFrames)
+        return;
+    LastGcFrame = FrameCount;
+    int runs_write = 0, text_write = 0;
+    ImVector<ImFontGlyphRunQuad> quads_kept;
+    quads_kept.reserve(Quads.Size);
+    LastRunIdx = -1;
+    Map.Clear();
+    Map.BuildHashIndex();
+    for (int run_n = 0; run_n < Runs.Size; run_n++)
+    {
+        ImFontGlyphRun run = Runs[run_n];
+        if (run.LastUsedFrame < FrameCount - GcFrames)
+            continue;
+        memmove(TextBuf.Data + text_write, TextBuf.Data + run.TextOffset, (size_t)run.TextLength);
+        run.TextOffset = text_write;
+        text_write += run.TextLength;
+        if (run.QuadsOffset != -1)
+        {
+            IM_ASSERT(run.QuadsOffset + run.QuadsCount <= Quads.Size);
+            quads_kept.resize(quads_kept.Size + run.QuadsCount);
+            if (run.QuadsCount > 0)
+                memcpy(quads_kept.Data + quads_kept.Size - run.QuadsCount, Quads.Data + run.QuadsOffset, (size_t)run.QuadsCount * sizeof(ImFontGlyphRunQuad));
+            run.QuadsOffset = quads_kept.Size - run.QuadsCount;
+        }
+        run.NextRunIdx = Map.GetInt(run.Hash, -1);
+        Map.SetInt(run.Hash, runs_write);
+        Runs[runs_write++] = run;
+    }
+    Runs.resize(runs_write);
+    TextBuf.resize(text_write);
+    Quads.swap(quads_kept);
+}
+
+// 64-bit hash processing 8 bytes at a time, cheaper than ImHashData() on typical labels and large paragraphs. Also used by ImFontWrapLayoutCache.
+static inline ImU64 TextHash64(const char* data, size_t data_size, ImU64 seed)
+{
+    ImU64 h = seed ^ ((ImU64)data_size * 0x9E3779B97F4A7C15ULL);
+    for (; data_size >= 8; data_size -= 8, data += 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        h = (h ^ v) * 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    if (data_size > 0)
+    {
+        ImU64 v = 0;
+        memcpy(&v, data, data_size);
+        h = (h ^ v) * 0xBF58476D1CE4E5B9ULL;
+        h ^= h >> 31;
+    }
+    h *= 0x94D049BB133111EBULL;
+    return h ^ (h >> 29);
+}
+
+static inline ImU64 TextHash64Seed(const ImFont* font, float size, float wrap_width)
+{
+    ImU32 size_bits, wrap_width_bits;
+    memcpy(&size_bits, &size, sizeof(size));
+    memcpy(&wrap_width_bits, &wrap_width, sizeof(wrap_width));
+    return (ImU64)(size_t)font ^ ((((ImU64)size_bits << 32) | wrap_width_bits) * 0x9E3779B97F4A7C15ULL);
+}
+
+static inline bool GlyphRunMatch(const ImFontGlyphRun& run, const char* run_text, const ImFont* font, float size, float wrap_width, const char* text, int text_len)
+{
+    return run.Font == font && run.FontSize == size && run.WrapWidth == wrap_width && run.TextLength == text_len && memcmp(run_text, text, (size_t)text_len) == 0;
+}
+
+// Find or add the run matching the given parameters. Newly added runs are measured but have no quads recorded yet.
+// Return NULL if the text is not cacheable. Quality of the hash matters less here as we compare contents on lookup.
+ImFontGlyphRun* ImFontGlyphRunCache::GetRun(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int text_len = (int)(text_end - text_begin);
+    if (text_len > TextMaxLength)
+        return NULL;
+
+    // Widgets typically measure then render the same text, so check the last used run before hashing.
+    if (LastRunIdx != -1 && GlyphRunMatch(Runs[LastRunIdx], TextBuf.Data + Runs[LastRunIdx].TextOffset, font, size, wrap_width, text_begin, text_len))
+    {
+        Runs[LastRunIdx].LastUsedFrame = FrameCount;
+        return &Runs[LastRunIdx];
+    }
+
+    const ImU64 hash64 = TextHash64(text_begin, (size_t)text_len, TextHash64Seed(font, size, wrap_width));
+    const ImU32 hash = (ImU32)(hash64 ^ (hash64 >> 32));
+    const int first_run_idx = Map.GetInt(hash, -1);
+    for (int run_idx = first_run_idx; run_idx != -1; run_idx = Runs[run_idx].NextRunIdx)
+        if (GlyphRunMatch(Runs[run_idx], TextBuf.Data + Runs[run_idx].TextOffset, font, size, wrap_width, text_begin, text_len))
+        {
+            Runs[run_idx].LastUsedFrame = FrameCount;
+            LastRunIdx = run_idx;
+            return &Runs[run_idx];
+        }
+
+    // Add new run, in front of the runs with the same hash, if any
+    ImFontGlyphRun run;
+    run.Hash = hash;
+    run.NextRunIdx = first_run_idx;
+    run.Font = font;
+    run.FontSize = size;
+    run.WrapWidth = wrap_width;
+    run.TextOffset = TextBuf.Size;
+    run.TextLength = text_len;
+    run.QuadsOffset = -1;
+    run.QuadsCount = 0;
+    run.TextSize = font->CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+    run.CreatedFrame = run.LastUsedFrame = FrameCount;
+    TextBuf.resize(TextBuf.Size + text_len);
+    memcpy(TextBuf.Data + run.TextOffset, text_begin, (size_t)text_len);
+    Map.BuildHashIndex(); // Runs are added and discarded frequently, don't use a sorted storage
+    Map.SetInt(hash, Runs.Size);
+    LastRunIdx = Runs.Size;
+    Runs.push_back(run);
+    MissCount++;
+    return &Runs.back();
+}
+
+// Equivalent to ImFont::CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end)
+ImVec2 ImFontGlyphRunCache::CalcTextSize(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int miss_count = MissCount;
+    if (ImFontGlyphRun* run = GetRun(font, size, wrap_width, text_begin, text_end))
+    {
+        if (MissCount == miss_count)
+            HitCount++;
+        return run->TextSize;
+    }
+    return font->CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end, NULL);
+}
+
+// Equivalent to ImFont::RenderText(). Return false if the text is not cached yet, in which case the caller should render it normally.
+bool ImFontGlyphRunCache::RenderText(ImDrawList* draw_list, const ImFont* font, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
+{
+    const int miss_count = MissCount;
+    ImFontGlyphRun* run = GetRun(font, size, wrap_width, text_begin, text_end);
+    if (run == NULL || MissCount != miss_count)
+        return false;
+
+    // Record glyph quads when the run is used again on a following frame, by rendering the text with the regular code path at (0,0) without clipping
+    if (run->QuadsOffset == -1)
+    {
+        if (run->CreatedFrame == FrameCount)
+            return false;
+        MissCount++;
+        ImDrawList* temp = &TempDrawList;
+        temp->Clear();
+        temp->PushClipRect(ImVec2(-FLT_MAX, -FLT_MAX), ImVec2(FLT_MAX, FLT_MAX));
+        temp->PushTextureID(font->GetTexID());
+        font->RenderText(temp, size, ImVec2(0.0f, 0.0f), IM_COL32_WHITE, temp->_ClipRectStack.back(), TextBuf.Data + run->TextOffset, TextBuf.Data + run->TextOffset + run->TextLength, wrap_width, false);
+        run->QuadsOffset = Quads.Size;
+        run->QuadsCount = temp->VtxBuffer.Size / 4;
+        Quads.resize(Quads.Size + run->QuadsCount);
+        ImFontGlyphRunQuad* quad = Quads.Data + run->QuadsOffset;
+        for (const ImDrawVert* vtx = temp->VtxBuffer.Data; vtx < temp->VtxBuffer.Data + temp->VtxBuffer.Size; vtx += 4, quad++)
+        {
+            quad->X0 = vtx[0].pos.x; quad->Y0 = vtx[0].pos.y; quad->X1 = vtx[2].pos.x; quad->Y1 = vtx[2].pos.y;
+            quad->U0 = vtx[0].uv.x;  quad->V0 = vtx[0].uv.y;  quad->U1 = vtx[2].uv.x;  quad->V1 = vtx[2].uv.y;
+        }
+    }
+    else
+    {
+        HitCount++;
+    }
+
+    // Same pixel alignment and clipping rules as ImFont::RenderText(), DisplayOffset is already baked in the quads.
+    const float x = (float)(int)pos.x;
+    const float y = (float)(int)pos.y;
+    if (y + font->DisplayOffset.y > clip_rect.w || run->QuadsCount == 0)
+        return true;
+
+    const int idx_count_max = run->QuadsCount * 6;
+    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+    draw_list->PrimReserve(idx_count_max, run->QuadsCount * 4);
+
+    ImDrawVert* vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx* idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_current_idx = draw_list->_VtxCurrentIdx;
+    const unsigned int vtx_current_idx_begin = vtx_current_idx;
+    int glyphs_clipped = 0;
+    for (const ImFontGlyphRunQuad* quad = Quads.Data + run->QuadsOffset, *quad_end = quad + run->QuadsCount; quad < quad_end; quad++)
+    {
+        float x1 = x + quad->X0;
+        float x2 = x + quad->X1;
+        float y1 = y + quad->Y0;
+        float y2 = y + quad->Y1;
+        if (y1 > clip_rect.w || y2 < clip_rect.y)
+            continue;
+        if (x1 > clip_rect.z || x2 < clip_rect.x)
+        {
+            glyphs_clipped++;
+            continue;
+        }
+        float u1 = quad->U0;
+        float v1 = quad->V0;
+        float u2 = quad->U1;
+        float v2 = quad->V1;
+        if (cpu_fine_clip)
+        {
+            if (x1 < clip_rect.x)
+            {
+                u1 = u1 + (1.0f - (x2 - clip_rect.x) / (x2 - x1)) * (u2 - u1);
+                x1 = clip_rect.x;
+            }
+            if (y1 < clip_rect.y)
+            {
+                v1 = v1 + (1.0f - (y2 - clip_rect.y) / (y2 - y1)) * (v2 - v1);
+                y1 = clip_rect.y;
+            }
+            if (x2 > clip_rect.z)
+            {
+                u2 = u1 + ((clip_rect.z - x1) / (x2 - x1)) * (u2 - u1);
+                x2 = clip_rect.z;
+            }
+            if (y2 > clip_rect.w)
+            {
+                v2 = v1 + ((clip_rect.w - y1) / (y2 - y1)) * (v2 - v1);
+                y2 = clip_rect.w;
+            }
+            if (y1 >= y2)
+            {
+                glyphs_clipped++;
+                continue;
+            }
+        }
+        idx_write[0] = (ImDrawIdx)(vtx_current_idx); idx_write[1] = (ImDrawIdx)(vtx_current_idx+1); idx_write[2] = (ImDrawIdx)(vtx_current_idx+2);
+        idx_write[3] = (ImDrawIdx)(vtx_current_idx); idx_write[4] = (ImDrawIdx)(vtx_current_idx+2); idx_write[5] = (ImDrawIdx)(vtx_current_idx+3);
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        vtx_write += 4;
+        vtx_current_idx += 4;
+        idx_write += 6;
+    }
+    ImDrawTextStats* stats = draw_list->_GetTextStats(font);
+    stats->GlyphCount += (int)(vtx_current_idx - vtx_current_idx_begin) / 4;
+    stats->GlyphClippedCount += glyphs_clipped;
+    stats->VtxCount += (int)(vtx_current_idx - vtx_current_idx_begin);
 
     // Give back unused vertices
     draw_list->VtxBuffer.resize((int)(vtx_write - draw_list->VtxBuffer.Data));
@@ -2930,7 +4710,130 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, ImVec2 pos, ImU32 col
     draw_list->CmdBuffer[draw_list->CmdBuffer.Size-1].ElemCount -= (idx_expected_size - draw_list->IdxBuffer.Size);
     draw_list->_VtxWritePtr = vtx_write;
     draw_list->_IdxWritePtr = idx_write;
-    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size;
+    draw_list->_VtxCurrentIdx = (unsigned int)draw_list->VtxBuffer.Size - draw_list->_VtxCurrentOffset;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImFontWrapLayoutCache
+//-----------------------------------------------------------------------------
+
+void ImFontWrapLayoutCache::Clear()
+{
+    Map.Clear();
+    Layouts.clear();
+    Lines.clear();
+    TempLines.clear();
+}
+
+// Called by NewFrame() when io.ConfigTextWrapLayoutCache is enabled
+void ImFontWrapLayoutCache::NewFrame(const ImFontAtlas* atlas)
+{
+    FrameCount++;
+    HitCountPrev = HitCount;
+    MissCountPrev = MissCount;
+    HitCount = MissCount = 0;
+    LazyBytes = 0;
+
+    // Font pointers and advances may have changed if the atlas has been rebuilt
+    if (TexID != atlas->TexID)
+    {
+        Clear();
+        TexID = atlas->TexID;
+        LastGcFrame = FrameCount;
+        return;
+    }
+
+    // Compact storage, discarding layouts which haven't been used recently and lines left behind by layouts computed again.
+    // Lines of a layout computed again are appended, so Lines[] isn't in the order of Layouts[]: copy the lines we keep to TempLines then swap.
+    if (FrameCount - LastGcFrame < GcFrames)
+        return;
+    LastGcFrame = FrameCount;
+    int layouts_write = 0;
+    Map.Clear();
+    Map.BuildHashIndex();
+    TempLines.resize(0);
+    for (int layout_n = 0; layout_n < Layouts.Size; layout_n++)
+    {
+        ImFontWrapLayout layout = Layouts[layout_n];
+        if (layout.LastUsedFrame < FrameCount - GcFrames)
+            continue;
+        IM_ASSERT(layout.LinesOffset >= 0 && layout.LinesOffset + layout.LinesCount <= Lines.Size);
+        TempLines.resize(TempLines.Size + layout.LinesCount);
+        if (layout.LinesCount > 0)
+            memcpy(TempLines.Data + TempLines.Size - layout.LinesCount, Lines.Data + layout.LinesOffset, (size_t)layout.LinesCount * sizeof(ImFontWrapLine));
+        layout.LinesOffset = TempLines.Size - layout.LinesCount;
+        Map.SetInt((ImGuiID)(layout.TextHash ^ (layout.TextHash >> 32)), layouts_write);
+        Layouts[layouts_write++] = layout;
+    }
+    Layouts.resize(layouts_write);
+    Lines.swap(TempLines);
+    TempLines.clear();
+}
+
+// Find or add the layout of the given text. The lines of an existing layout are computed again if the wrap width differs, unless 'allow_stale' is set.
+ImFontWrapLayout* ImFontWrapLayoutCache::GetLayout(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, bool allow_stale)
+{
+    IM_ASSERT(wrap_width > 0.0f);
+    const int text_len = (int)(text_end - text_begin);
+    const ImU64 text_hash = TextHash64(text_begin, (size_t)text_len, TextHash64Seed(font, size, 0.0f));
+    const ImGuiID key = (ImGuiID)(text_hash ^ (text_hash >> 32));
+    int layout_idx = Map.GetInt(key, -1);
+    if (layout_idx != -1)
+    {
+        ImFontWrapLayout* layout = &Layouts[layout_idx];
+        if (layout->TextHash == text_hash && layout->Font == font && layout->FontSize == size && layout->TextLength == text_len)
+        {
+            layout->LastUsedFrame = FrameCount;
+            if (layout->WrapWidth == wrap_width || allow_stale)
+            {
+                HitCount++;
+                return layout;
+            }
+        }
+        else
+        {
+            layout_idx = -1;
+        }
+    }
+
+    // Add new layout (overwriting the map entry of a colliding layout, if any), or compute the lines of an existing one again
+    if (layout_idx == -1)
+    {
+        ImFontWrapLayout new_layout;
+        new_layout.TextHash = text_hash;
+        new_layout.Font = font;
+        new_layout.FontSize = size;
+        new_layout.TextLength = text_len;
+        new_layout.LinesOffset = new_layout.LinesCount = 0;
+        new_layout.LastUsedFrame = FrameCount;
+        Map.BuildHashIndex(); // Keys are hashes added in random order, don't use a sorted storage
+        Map.SetInt(key, Layouts.Size);
+        layout_idx = Layouts.Size;
+        Layouts.push_back(new_layout);
+    }
+    MissCount++;
+
+    // Lines are stored in place when they fit, otherwise appended (the old ones are discarded on the next compaction)
+    ImFontWrapLayout* layout = &Layouts[layout_idx];
+    TempLines.resize(0);
+    layout->WrapWidth = wrap_width;
+    layout->TextSize = font->CalcWordWrapLayoutA(size, wrap_width, text_begin, text_end, &TempLines);
+    if (TempLines.Size > layout->LinesCount)
+    {
+        layout->LinesOffset = Lines.Size;
+        Lines.resize(Lines.Size + TempLines.Size);
+    }
+    layout->LinesCount = TempLines.Size;
+    if (TempLines.Size > 0)
+        memcpy(Lines.Data + layout->LinesOffset, TempLines.Data, (size_t)TempLines.Size * sizeof(ImFontWrapLine));
+    return layout;
+}
+
+// Equivalent to ImFont::CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end)
+ImVec2 ImFontWrapLayoutCache::CalcTextSize(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    return GetLayout(font, size, wrap_width, text_begin, text_end, false)->TextSize;
 }
 
 //-----------------------------------------------------------------------------
@@ -61,6 +61,9 @@ Index of this file:
 struct ImRect;                      // An axis-aligned rectangle (2 points)
 struct ImDrawDataBuilder;           // Helper to build a ImDrawData instance
 struct ImDrawListSharedData;        // Data shared between all ImDrawList instances
+struct ImFontGlyphRunCache;         // Cache of laid out text runs, used by ImFont::RenderText() and CalcTextSize()
+struct ImFontWrapLayoutCache;       // Cache of word-wrapped text line breaks, used by ImFont::RenderText() and CalcTextSize()
+struct ImFontGlyphToLoad;           // A glyph not rasterized yet, to be loaded on the main thread (draw list jobs)
 struct ImGuiColorMod;               // Stacked color modifier, backup of modified data so we can restore it
 struct ImGuiColumnData;             // Storage data for a single column
 struct ImGuiColumnsSet;             // Storage data for a columns set
@@ -77,6 +80,7 @@ struct ImGuiStyleMod;               // Stacked style modifier, backup of modifie
 struct ImGuiTabBar;                 // Storage for a tab bar
 struct ImGuiTabItem;                // Storage for a tab item (within a tab bar)
 struct ImGuiWindow;                 // Storage for one window
+struct ImGuiWindowHitGrid;          // Uniform grid of the windows rectangles, to find the window under a point without testing every window
 struct ImGuiWindowTempData;         // Temporary storage for one window (that's the data which in theory we could ditch at the end of the frame)
 struct ImGuiWindowSettings;         // Storage for window settings stored in .ini file (we keep one of those even if the actual window wasn't instanced during this session)
 
@@ -150,6 +154,7 @@ IMGUI_API int           ImTextCountUtf8BytesFromStr(const ImWchar* in_text, cons
 // Helpers: Misc
 IMGUI_API ImU32         ImHashData(const void* data, size_t data_size, ImU32 seed = 0);
 IMGUI_API ImU32         ImHashStr(const char* data, size_t data_size, ImU32 seed = 0);
+IMGUI_API ImU64         ImHashData64(const void* data, size_t data_size, ImU64 seed = 0);     // Faster hash for bulk data, e.g. draw list contents
 IMGUI_API void*         ImFileLoadToMemory(const char* filename, const char* file_open_mode, size_t* out_file_size = NULL, int padding_bytes = 0);
 IMGUI_API FILE*         ImFileOpen(const char* filename, const char* file_open_mode);
 static inline bool      ImCharIsBlankA(char c)          { return c == ' ' || c == '\t'; }
@@ -259,6 +264,26 @@ struct ImBoolVector
     void            SetBit(int n, bool v)   { int off = (n >> 5); int mask = 1 << (n & 31); if (v) Storage[off] |= mask; else Storage[off] &= ~mask; }
 };
 
+// Helper: ImFrameArena. Linear allocator for transient data which is released all at once (used by ImGui::MemAllocFrame(), reset by NewFrame()).
+// Blocks are kept from one reset to the next and coalesced into a single block on reset, so steady-state usage doesn't touch the heap.
+// The block is shrunk when it is much larger than what the last frame used, so a one-off spike (e.g. pasting a large text) isn't kept forever.
+struct IMGUI_API ImFrameArena
+{
+    struct Block { char* Data; int Size; };
+    ImVector<Block> Blocks;
+    int             BlockIdx;       // Current block
+    int             BlockOffset;    // Offset of free space in current block
+    int             BlockMinSize;   // Size of new blocks, unless a larger allocation is requested
+    int             UsedBytes;      // Bytes allocated since the last reset
+
+    ImFrameArena()  { BlockIdx = BlockOffset = UsedBytes = 0; BlockMinSize = 64 * 1024; }
+    ~ImFrameArena() { Clear(); }
+    void*           Alloc(size_t size);
+    void            Reset();
+    void            Clear();
+    int             GetCapacity() const { int sz = 0; for (int n = 0; n < Blocks.Size; n++) sz += Blocks[n].Size; return sz; }
+};
+
 // Helper: ImPool<>. Basic keyed storage for contiguous instances, slow/amortized insertion, O(1) indexable, O(Log N) queries by ID over a dense/hot buffer,
 // Honor constructor/destructor. Add/remove invalidate all pointers. Indexes have the same lifetime as the associated object.
 typedef int ImPoolIdx;
@@ -557,6 +582,14 @@ struct IMGUI_API ImGuiMenuColumns
     float       CalcExtraSpace(float avail_w);
 };
 
+// Line of the InputText() edit buffer, see ImGuiInputTextState::Lines
+struct ImGuiInputTextLine
+{
+    int                     StartW;                 // offset of the first character of the line in TextW
+    int                     StartA;                 // offset of the first character of the line in the UTF-8 conversion of TextW (TempBuffer)
+    float                   Width;                  // cached width of the line, excluding the trailing \n. < 0.0f when it needs to be measured again.
+};
+
 // Internal state of the currently focused/edited text input box
 struct IMGUI_API ImGuiInputTextState
 {
@@ -564,7 +597,12 @@ struct IMGUI_API ImGuiInputTextState
     ImVector<ImWchar>       TextW;                  // edit buffer, we need to persist but can't guarantee the persistence of the user-provided buffer. so we copy into own buffer.
     ImVector<char>          InitialText;            // backup of end-user buffer at the time of focus (in UTF-8, unaltered)
     ImVector<char>          TempBuffer;             // temporary buffer for callback and other other operations. size=capacity.
+    bool                    TempBufferDirty;        // TextW was modified (or TempBuffer reused for something else) since TextW was last converted into TempBuffer
     int                     CurLenA, CurLenW;       // we need to maintain our buffer length in both UTF-8 and wchar format.
+    ImVector<ImGuiInputTextLine> Lines;             // line index of TextW (always at least 1 entry). Rebuilt on activation, then updated incrementally by STB_TEXTEDIT_INSERTCHARS/STB_TEXTEDIT_DELETECHARS so large multi-line buffers don't need to be scanned every frame.
+    int                     LinesLastIdx;           // last result of FindLine(), consecutive lookups are frequent (e.g. stb_textedit iterating rows)
+    ImFont*                 LinesFont;              // font and size Lines[].Width were measured with
+    float                   LinesFontSize;
     int                     BufCapacityA;           // end-user buffer capacity
     float                   ScrollX;
     ImGuiStb::STB_TexteditState StbState;
@@ -584,6 +622,8 @@ struct IMGUI_API ImGuiInputTextState
     void                ClearSelection()            { StbState.select_start = StbState.select_end = StbState.cursor; }
     void                SelectAll()                 { StbState.select_start = 0; StbState.cursor = StbState.select_end = CurLenW; StbState.has_preferred_x = false; }
     void                OnKeyPressed(int key);      // Cannot be inline because we call in code in stb_textedit.h implementation
+    void                RebuildLines();             // Rebuild Lines[] from TextW, to call after modifying TextW other than through the stb_textedit callbacks
+    int                 FindLine(int pos);          // Return index into Lines[] of the line containing character 'pos' of TextW
 };
 
 // Windows data saved in imgui.ini file
@@ -622,6 +662,39 @@ struct ImGuiPopupRef
     ImVec2              OpenMousePos;   // Set on OpenPopup(), copy of mouse position at the time of opening popup
 };
 
+// A visible window (or a window hidden because occluded) and its hit rectangle (OuterRectClipped expanded by the touch/resize padding)
+struct ImGuiWindowHitGridEntry
+{
+    ImGuiWindow*        Window;
+    ImRect              Rect;
+    bool                Hoverable;
+};
+
+// Uniform grid of the windows rectangles of the last frame, so that FindHoveredWindow() only tests the windows overlapping the cell under the mouse,
+// and Begin() only tests the windows overlapping the center of a window to find if it is occluded (io.ConfigWindowsOcclusionCulling).
+// Built by EndFrame() once g.Windows has been sorted. Cells store indices in Entries[] in ascending order (= back to front), covering the union of
+// the rectangles clipped to the display. The outer cells extend to infinity. Cells are sized from the average window size, so a window spans few cells.
+// The cells are only rebuilt when a window rectangle or the display order changed since the last frame.
+struct IMGUI_API ImGuiWindowHitGrid
+{
+    int                 FrameCount;                 // Frame for which the grid was built. -1 when invalidated (e.g. g.Windows order changed by a focus request in NewFrame())
+    ImVector<ImGuiWindowHitGridEntry> Entries;      // Visible windows (and windows hidden because occluded), back to front
+    ImVector<int>       CellsStart;                 // Entries of cell n are CellsEntries[CellsStart[n]] to CellsEntries[CellsStart[n+1]-1]
+    ImVector<int>       CellsEntries;               // Indices in Entries[]
+    ImRect              DisplayRect;                // Display rectangle the grid was built for
+    ImVec2              Min;                        // Top-left corner of the first cell
+    ImVec2              CellSizeInv;                // Inverse of the size of a cell
+    int                 CellsX, CellsY;
+
+    ImGuiWindowHitGrid()    { FrameCount = -1; Min = CellSizeInv = ImVec2(0.0f, 0.0f); CellsX = CellsY = 0; }
+    void                Clear() { FrameCount = -1; Entries.clear(); CellsStart.clear(); CellsEntries.clear(); CellsX = CellsY = 0; }
+    void                Build(const ImRect& display_rect);  // Build cells from Entries[]
+    ImGuiWindow*        FindWindow(const ImVec2& pos) const;// Front-most hoverable window whose rectangle contains 'pos', NULL if none
+    bool                IsWindowOccluded(ImGuiWindow* window, const ImRect& rect) const; // Is 'rect' contained in the OccludingRect of a window in front of 'window'
+    int                 GetCellX(float x) const { return (int)ImClamp((x - Min.x) * CellSizeInv.x, 0.0f, (float)(CellsX - 1)); }
+    int                 GetCellY(float y) const { return (int)ImClamp((y - Min.y) * CellSizeInv.y, 0.0f, (float)(CellsY - 1)); }
+};
+
 struct ImGuiColumnData
 {
     float               OffsetNorm;         // Column start offset, normalized 0.0 (far left) -> 1.0 (far right)
@@ -671,6 +744,9 @@ struct IMGUI_API ImDrawListSharedData
     float           FontSize;                   // Current/default font size (optional, for simplified AddText overload)
     float           CurveTessellationTol;
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
+    ImFontGlyphRunCache* GlyphRunCache;         // Optional glyph-run cache used by ImFont::RenderText() (set by the context when io.ConfigTextGlyphRunCache is enabled)
+    ImFontWrapLayoutCache* WrapLayoutCache;     // Optional wrap layout cache used by ImFont::RenderText() (set by the context when io.ConfigTextWrapLayoutCache is enabled)
+    ImVector<ImFontGlyphToLoad>* GlyphsToLoad;  // When set, ImFont::RenderText() doesn't modify fonts, so it can run on worker threads (draw list jobs): glyphs not rasterized yet (ImFontAtlasFlags_DynamicGlyphs) are drawn with the fallback glyph and added here, to be loaded later on the main thread
 
     // Const data
     // FIXME: Bake rounded corners fill/borders in atlas
@@ -679,6 +755,121 @@ struct IMGUI_API ImDrawListSharedData
     ImDrawListSharedData();
 };
 
+// A glyph not rasterized yet, found by ImFont::RenderText() in read-only mode, see ImDrawListSharedData::GlyphsToLoad
+struct ImFontGlyphToLoad
+{
+    ImFont*         Font;
+    ImWchar         Codepoint;
+};
+
+// A text run laid out with a given font, size and wrap width, see ImFontGlyphRunCache.
+// Quads are relative to the pixel-aligned text position and exclude blank characters.
+struct ImFontGlyphRun
+{
+    ImU32           Hash;                       // Hash of all the fields below + text
+    int             NextRunIdx;                 // Next run with the same Hash in ImFontGlyphRunCache::Runs[] (collision chain), or -1
+    const ImFont*   Font;
+    float           FontSize;
+    float           WrapWidth;
+    int             TextOffset, TextLength;     // Copy of the text in ImFontGlyphRunCache::TextBuf, to rule out hash collisions
+    int             QuadsOffset, QuadsCount;    // Glyph quads in ImFontGlyphRunCache::Quads. QuadsOffset == -1 until the run is rendered on a frame following its creation
+    ImVec2          TextSize;                   // Result of ImFont::CalcTextSizeA(FontSize, FLT_MAX, WrapWidth, text)
+    int             CreatedFrame;
+    int             LastUsedFrame;
+};
+
+struct ImFontGlyphRunQuad
+{
+    float           X0, Y0, X1, Y1;
+    float           U0, V0, U1, V1;
+};
+
+// Cache of laid out text, keyed by font, size, wrap width and text contents.
+// - Runs are measured the first time they are seen and their glyph quads are recorded when they are rendered again on a following
+//   frame, so text which changes every frame (e.g. numbers) doesn't pay for the recording. Following calls copy and translate the quads.
+// - Runs unused for GcFrames frames are discarded. The whole cache is cleared when the font atlas texture changes.
+// - Only texts shorter than TextMaxLength are cached: large blocks of text rely on coarse line clipping instead.
+struct IMGUI_API ImFontGlyphRunCache
+{
+    ImGuiStorage                    Map;        // Hash -> index in Runs[] of the first run of the collision chain
+    ImVector<ImFontGlyphRun>        Runs;
+    ImVector<char>                  TextBuf;
+    ImVector<ImFontGlyphRunQuad>    Quads;
+    ImDrawListSharedData            TempDrawListSharedData;
+    ImDrawList                      TempDrawList; // Used to record glyph quads with the regular ImFont::RenderText() code
+    int                             FrameCount;
+    int                             LastGcFrame;
+    int                             GcFrames;
+    int                             TextMaxLength;
+    int                             LastRunIdx; // Index of the last run returned by GetRun()
+    ImTextureID                     TexID;      // Atlas state when the quads were recorded
+    ImVec2                          TexUvWhitePixel;
+    int                             TexGlyphsGeneration;
+    int                             HitCount, MissCount, HitCountPrev, MissCountPrev;
+
+    ImFontGlyphRunCache() : TempDrawList(&TempDrawListSharedData) { FrameCount = LastGcFrame = 0; GcFrames = 60; TextMaxLength = 512; LastRunIdx = -1; TexID = NULL; TexGlyphsGeneration = 0; HitCount = MissCount = HitCountPrev = MissCountPrev = 0; }
+    void                Clear();
+    void                NewFrame(const ImFontAtlas* atlas);
+    ImFontGlyphRun*     GetRun(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end);
+    ImVec2              CalcTextSize(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end);
+    bool                RenderText(ImDrawList* draw_list, const ImFont* font, float size, ImVec2 pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip);
+    int                 GetMemoryUsage() const  { return Runs.Size * (int)sizeof(ImFontGlyphRun) + TextBuf.Size + Quads.Size * (int)sizeof(ImFontGlyphRunQuad) + Map.Data.Size * (int)sizeof(ImGuiStorage::Pair) + Map.HashIndex.Size * (int)sizeof(int); }
+};
+
+// Line breaks of a text word-wrapped with a given font and size, see ImFontWrapLayoutCache.
+struct ImFontWrapLayout
+{
+    ImU64           TextHash;                   // 64-bit hash of the font, size and text contents. The text is not copied, large paragraphs are the intended use.
+    const ImFont*   Font;
+    float           FontSize;
+    float           WrapWidth;                  // Wrap width the lines were computed for
+    int             TextLength;
+    int             LinesOffset, LinesCount;    // Lines in ImFontWrapLayoutCache::Lines
+    ImVec2          TextSize;                   // Result of ImFont::CalcTextSizeA(FontSize, FLT_MAX, WrapWidth, text)
+    int             LastUsedFrame;
+};
+
+// Cache of word-wrapped text, keyed by font, size and text contents.
+// - The key doesn't include the wrap width: when it changes (e.g. window resize) the lines of the same entry are computed again.
+//   Callers may ask for a stale layout to skip wrapping text which is clipped anyway, see ImGui::CalcTextSizeWrappedLazy().
+//   Clipped layouts are still computed again within a per-frame budget, so sizes converge a few frames after the wrap width stops changing.
+// - Lines are computed with ImFont::CalcWordWrapLayoutA(), and ImFont::RenderText() only processes the lines within the clipping rectangle.
+// - Layouts unused for GcFrames frames are discarded. The whole cache is cleared when the font atlas texture changes.
+struct IMGUI_API ImFontWrapLayoutCache
+{
+    ImGuiStorage                    Map;        // Hash -> index in Layouts[]
+    ImVector<ImFontWrapLayout>      Layouts;
+    ImVector<ImFontWrapLine>        Lines;
+    ImVector<ImFontWrapLine>        TempLines;
+    int                             FrameCount;
+    int                             LastGcFrame;
+    int                             GcFrames;
+    int                             LazyBudget; // Text bytes of clipped layouts which may be computed again per frame
+    int                             LazyBytes;  // Text bytes of clipped layouts computed again this frame
+    ImTextureID                     TexID;      // Atlas state when the lines were computed
+    int                             HitCount, MissCount, HitCountPrev, MissCountPrev;
+
+    ImFontWrapLayoutCache()         { FrameCount = LastGcFrame = 0; GcFrames = 60; LazyBudget = 64 * 1024; LazyBytes = 0; TexID = NULL; HitCount = MissCount = HitCountPrev = MissCountPrev = 0; }
+    void                Clear();
+    void                NewFrame(const ImFontAtlas* atlas);
+    ImFontWrapLayout*   GetLayout(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end, bool allow_stale);
+    ImVec2              CalcTextSize(const ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end);
+    int                 GetMemoryUsage() const  { return Layouts.Size * (int)sizeof(ImFontWrapLayout) + (Lines.Size + TempLines.Size) * (int)sizeof(ImFontWrapLine) + Map.Data.Size * (int)sizeof(ImGuiStorage::Pair) + Map.HashIndex.Size * (int)sizeof(int); }
+};
+
+// Storage for a draw list job, see AddDrawListJob().
+// The shared data is copied when the job is added, so the job can run on a worker thread without touching the context.
+struct ImDrawListJob
+{
+    ImDrawListSharedData    SharedData;         // Private copy of the context shared data (font, white pixel uv, tessellation tolerance) as of when the job was added
+    ImDrawList              DrawList;           // Output, setup with the flags, texture and clipping rectangle of the parent window when the job was added
+    ImDrawListJobCallback   Callback;
+    void*                   UserData;
+    ImVector<ImFontGlyphToLoad> GlyphsToLoad;   // Glyphs missing from an ImFontAtlasFlags_DynamicGlyphs atlas, loaded by Render() after the job has run
+
+    ImDrawListJob() : DrawList(&SharedData) { Callback = NULL; UserData = NULL; }
+};
+
 struct ImDrawDataBuilder
 {
     ImVector<ImDrawList*>   Layers[2];           // Global layers for: regular, tooltip
@@ -776,9 +967,15 @@ struct ImGuiContext
     ImVector<ImGuiWindow*>  Windows;                            // Windows, sorted in display order, back to front
     ImVector<ImGuiWindow*>  WindowsFocusOrder;                  // Windows, sorted in focus order, back to front
     ImVector<ImGuiWindow*>  WindowsSortBuffer;
+    ImGuiWindowHitGrid      WindowsHitGrid;                     // Spatial index of the windows rectangles, built by EndFrame() and used by FindHoveredWindow() on the next frame
     ImVector<ImGuiWindow*>  CurrentWindowStack;
     ImGuiStorage            WindowsById;
     int                     WindowsActiveCount;
+    int                     WindowsOccludedCount;               // Number of windows hidden because occluded during the current frame (io.ConfigWindowsOcclusionCulling)
+    int                     WindowsOccludedVtxCount;            // Vertices of those windows the last time they were displayed
+    int                     WindowsOccludedCountPrev, WindowsOccludedVtxCountPrev; // Values for the previous frame, for display in Metrics window
+    int                     WindowsOccludedFramesTotal;         // Total number of window-frames skipped because occluded since the context was created
+    ImU64                   WindowsOccludedVtxTotal;            // Total number of vertices saved
     ImGuiWindow*            CurrentWindow;                      // Being drawn into
     ImGuiWindow*            HoveredWindow;                      // Will catch mouse inputs
     ImGuiWindow*            HoveredRootWindow;                  // Will catch mouse inputs (for focus/move only)
@@ -863,6 +1060,10 @@ struct ImGuiContext
     float                   DimBgRatio;                         // 0.0..1.0 animation when fading in a dimming background (for modal window and CTRL+TAB list)
     ImDrawList              OverlayDrawList;                    // Optional software render of mouse cursors, if io.MouseDrawCursor is set + a few debug overlays
     ImGuiMouseCursor        MouseCursor;
+    ImVector<ImDrawListJob*> DrawListJobs;                      // Pool of draw list jobs, reused every frame (pointers are stable)
+    int                     DrawListJobsCount;                  // Number of jobs in DrawListJobs[] added this frame
+    ImFontGlyphRunCache     GlyphRunCache;                      // Cache of laid out text, used when io.ConfigTextGlyphRunCache is set
+    ImFontWrapLayoutCache   WrapLayoutCache;                    // Cache of word-wrapped text line breaks, used when io.ConfigTextWrapLayoutCache is set
 
     // Drag and Drop
     bool                    DragDropActive;
@@ -921,6 +1122,17 @@ struct ImGuiContext
     int                     LogStartDepth;
     int                     LogAutoExpandMaxDepth;
 
+    // Memory
+    ImFrameArena            FrameArena;                         // Default storage for MemAllocFrame(), reset by NewFrame()
+    void*                   (*FrameAllocFunc)(size_t size, void* user_data);   // Custom frame allocator (see SetFrameAllocatorFunctions()), NULL to use FrameArena
+    void                    (*FrameResetFunc)(void* user_data);
+    void*                   FrameAllocUserData;
+    int                     FrameHeapAllocCount;                // Number of MemAlloc() calls during the current frame
+    int                     FrameHeapAllocBytes;
+    int                     FrameArenaAllocCount;               // Number of MemAllocFrame() calls during the current frame
+    int                     FrameArenaAllocBytes;
+    int                     FrameHeapAllocCountPrev, FrameHeapAllocBytesPrev, FrameArenaAllocCountPrev, FrameArenaAllocBytesPrev; // Values for the previous frame, for display in Metrics window
+
     // Misc
     float                   FramerateSecPerFrame[120];          // Calculate estimate of framerate for user over the last 2 seconds.
     int                     FramerateSecPerFrameIdx;
@@ -943,6 +1155,9 @@ struct ImGuiContext
         FrameCount = 0;
         FrameCountEnded = FrameCountRendered = -1;
         WindowsActiveCount = 0;
+        WindowsOccludedCount = WindowsOccludedVtxCount = WindowsOccludedCountPrev = WindowsOccludedVtxCountPrev = 0;
+        WindowsOccludedFramesTotal = 0;
+        WindowsOccludedVtxTotal = 0;
         CurrentWindow = NULL;
         HoveredWindow = NULL;
         HoveredRootWindow = NULL;
@@ -1001,6 +1216,7 @@ struct ImGuiContext
         OverlayDrawList._Data = &DrawListSharedData;
         OverlayDrawList._OwnerName = "##Overlay"; // Give it a name for debugging
         MouseCursor = ImGuiMouseCursor_Arrow;
+        DrawListJobsCount = 0;
 
         DragDropActive = DragDropWithinSourceOrTarget = false;
         DragDropSourceFlags = 0;
@@ -1033,6 +1249,12 @@ struct ImGuiContext
         LogStartDepth = 0;
         LogAutoExpandMaxDepth = 2;
 
+        FrameAllocFunc = NULL;
+        FrameResetFunc = NULL;
+        FrameAllocUserData = NULL;
+        FrameHeapAllocCount = FrameHeapAllocBytes = FrameArenaAllocCount = FrameArenaAllocBytes = 0;
+        FrameHeapAllocCountPrev = FrameHeapAllocBytesPrev = FrameArenaAllocCountPrev = FrameArenaAllocBytesPrev = 0;
+
         memset(FramerateSecPerFrame, 0, sizeof(FramerateSecPerFrame));
         FramerateSecPerFrameIdx = 0;
         FramerateSecPerFrameAccum = 0.0f;
@@ -1155,6 +1377,7 @@ struct IMGUI_API ImGuiWindow
     bool                    SkipItems;                          // Set when items can safely be all clipped (e.g. window not visible or collapsed)
     bool                    Appearing;                          // Set during the frame where the window is appearing (or re-appearing)
     bool                    Hidden;                             // Do not display (== (HiddenFramesForResize > 0) ||
+    bool                    Occluded;                           // Hidden this frame because fully covered by an opaque window in front of it (io.ConfigWindowsOcclusionCulling)
     bool                    HasCloseButton;                     // Set when the window has a close button (p_open != NULL)
     signed char             ResizeBorderHeld;                   // Current border being held for resize (-1: none, otherwise 0-3)
     short                   BeginCount;                         // Number of Begin() during the current frame (generally 0 or 1, 1+ if appending via multiple Begin/End pairs)
@@ -1177,6 +1400,9 @@ struct IMGUI_API ImGuiWindow
     ImVector<ImGuiID>       IDStack;                            // ID stack. ID are hashes seeded with the value at the top of the stack
     ImRect                  ClipRect;                           // Current clipping rectangle. = DrawList->clip_rect_stack.back(). Scissoring / clipping rectangle. x1, y1, x2, y2.
     ImRect                  OuterRectClipped;                   // = WindowRect just after setup in Begin(). == window->Rect() for root window.
+    ImRect                  OccludingRect;                      // Part of OuterRectClipped fully covered by opaque background (not including rounded corners). Inverted if the background is translucent.
+    int                     OccludedFrames;                     // Number of frames the window was hidden because occluded (for Metrics)
+    int                     OccludedVtxCount;                   // Vertices of the window draw list the last time it was displayed, counted as saved for each occluded frame (for Metrics)
     ImRect                  InnerMainRect, InnerClipRect;
     ImRect                  ContentsRegionRect;                 // FIXME: This is currently confusing/misleading. Maximum visible content position ~~ Pos + (SizeContentsExplicit ? SizeContentsExplicit : Size - ScrollbarSizes) - CursorStartPos, per axis
     int                     LastFrameActive;                    // Last frame number the window was Active.
@@ -1189,6 +1415,7 @@ struct IMGUI_API ImGuiWindow
 
     ImDrawList*             DrawList;                           // == &DrawListInst (for backward compatibility reason with code using imgui_internal.h we keep this a pointer)
     ImDrawList              DrawListInst;
+    ImVector<ImDrawListJob*> DrawListJobs;                      // Draw list jobs added to this window this frame, rendered right after DrawList
     ImGuiWindow*            ParentWindow;                       // If we are a child _or_ popup window, this is pointing to our parent. Otherwise NULL.
     ImGuiWindow*            RootWindow;                         // Point to ourself or first ancestor that is not a child window.
     ImGuiWindow*            RootWindowForTitleBarHighlight;     // Point to ourself or first ancestor which will display TitleBgActive color when this window is active.
@@ -1365,6 +1592,7 @@ namespace ImGui
     IMGUI_API void          FocusableItemUnregister(ImGuiWindow* window);
     IMGUI_API ImVec2        CalcItemSize(ImVec2 size, float default_x, float default_y);
     IMGUI_API float         CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x);
+    IMGUI_API ImVec2        CalcTextSizeWrappedLazy(const char* text, const char* text_end, float wrap_width, const ImVec2& pos); // Same as CalcTextSize() but may return the size from a previous wrap width if the text at 'pos' is clipped (io.ConfigTextWrapLayoutCache)
     IMGUI_API void          PushMultiItemsWidths(int components, float width_full = 0.0f);
     IMGUI_API void          PushItemFlag(ImGuiItemFlags option, bool enabled);
     IMGUI_API void          PopItemFlag();
@@ -1479,6 +1707,7 @@ namespace ImGui
 
     // Plot
     IMGUI_API void          PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size);
+    IMGUI_API void          PlotPyramidEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotPyramid* values, int values_offset, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size);
 
     // Shade functions (write over already created vertices)
     IMGUI_API void          ShadeVertsLinearColorGradientKeepAlpha(ImDrawList* draw_list, int vert_start_idx, int vert_end_idx, ImVec2 gradient_p0, ImVec2 gradient_p1, ImU32 col0, ImU32 col1);
@@ -1494,6 +1723,7 @@ IMGUI_API void              ImFontAtlasBuildPackCustomRects(ImFontAtlas* atlas,
 IMGUI_API void              ImFontAtlasBuildFinish(ImFontAtlas* atlas);
 IMGUI_API void              ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void              ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
+IMGUI_API void              ImFontAtlasDynamicGlyphsNewFrame(ImFontAtlas* atlas);
 
 // Test engine hooks (imgui-test)
 //#define IMGUI_ENABLE_TEST_ENGINE
@@ -218,7 +218,7 @@ void ImGui::TextUnformatted(const char* text, const char* text_end)
     else
     {
         const float wrap_width = wrap_enabled ? CalcWrapWidthForPos(window->DC.CursorPos, wrap_pos_x) : 0.0f;
-        const ImVec2 text_size = CalcTextSize(text_begin, text_end, false, wrap_width);
+        const ImVec2 text_size = wrap_enabled ? CalcTextSizeWrappedLazy(text_begin, text_end, wrap_width, text_pos) : CalcTextSize(text_begin, text_end, false, wrap_width);
 
         // Account of baseline offset
         ImRect bb(text_pos, text_pos + text_size);
@@ -2843,15 +2843,11 @@ bool ImGui::InputTextMultiline(const char* label, char* buf, size_t buf_size, co
 
 static int InputTextCalcTextLenAndLineCount(const char* text_begin, const char** out_text_end)
 {
-    int line_count = 0;
-    const char* s = text_begin;
-    while (char c = *s++) // We are only matching for \n so we can ignore UTF-8 decoding
-        if (c == '\n')
-            line_count++;
-    s--;
-    if (s[0] != '\n' && s[0] != '\r')
+    int line_count = 1;
+    const char* text_end = text_begin + strlen(text_begin);
+    for (const char* s = text_begin; (s = (const char*)memchr(s, '\n', (size_t)(text_end - s))) != NULL; s++) // We are only matching for \n so we can ignore UTF-8 decoding
         line_count++;
-    *out_text_end = s;
+    *out_text_end = text_end;
     return line_count;
 }
 
@@ -2906,19 +2902,46 @@ namespace ImGuiStb
 static int     STB_TEXTEDIT_STRINGLEN(const STB_TEXTEDIT_STRING* obj)                             { return obj->CurLenW; }
 static ImWchar STB_TEXTEDIT_GETCHAR(const STB_TEXTEDIT_STRING* obj, int idx)                      { return obj->TextW[idx]; }
 static float   STB_TEXTEDIT_GETWIDTH(STB_TEXTEDIT_STRING* obj, int line_start_idx, int char_idx)  { ImWchar c = obj->TextW[line_start_idx+char_idx]; if (c == '\n') return STB_TEXTEDIT_GETWIDTH_NEWLINE; return GImGui->Font->GetCharAdvance(c) * (GImGui->FontSize / GImGui->Font->FontSize); }
-static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x10000 ? 0 : key; }
+static int     STB_TEXTEDIT_KEYTOTEXT(int key)                                                    { return key >= 0x200000 ? 0 : key; }
 static ImWchar STB_TEXTEDIT_NEWLINE = '\n';
 static void    STB_TEXTEDIT_LAYOUTROW(StbTexteditRow* r, STB_TEXTEDIT_STRING* obj, int line_start_idx)
 {
+    // We don't wrap so rows always start at the beginning of a line: use the line index and its cached widths.
+    // (stb_textedit iterates all rows above the cursor/mouse position, which would be O(buffer) per query if measuring everything again)
+    ImGuiContext& g = *GImGui;
+    if (obj->LinesFont != g.Font || obj->LinesFontSize != g.FontSize)
+    {
+        for (int n = 0; n < obj->Lines.Size; n++)
+            obj->Lines[n].Width = -1.0f;
+        obj->LinesFont = g.Font;
+        obj->LinesFontSize = g.FontSize;
+    }
+
     const ImWchar* text = obj->TextW.Data;
-    const ImWchar* text_remaining = NULL;
-    const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
+    const int line_idx = obj->Lines.Size > 0 ? obj->FindLine(line_start_idx) : -1;
+    if (line_idx < 0 || obj->Lines[line_idx].StartW != line_start_idx)
+    {
+        const ImWchar* text_remaining = NULL;
+        const ImVec2 size = InputTextCalcTextSizeW(text + line_start_idx, text + obj->CurLenW, &text_remaining, NULL, true);
+        r->x0 = 0.0f;
+        r->x1 = size.x;
+        r->baseline_y_delta = size.y;
+        r->ymin = 0.0f;
+        r->ymax = size.y;
+        r->num_chars = (int)(text_remaining - (text + line_start_idx));
+        return;
+    }
+
+    ImGuiInputTextLine& line = obj->Lines[line_idx];
+    const int line_end_idx = (line_idx + 1 < obj->Lines.Size) ? obj->Lines[line_idx + 1].StartW : obj->CurLenW;
+    if (line.Width < 0.0f)
+        line.Width = InputTextCalcTextSizeW(text + line.StartW, text + line_end_idx, NULL, NULL, true).x;
     r->x0 = 0.0f;
-    r->x1 = size.x;
-    r->baseline_y_delta = size.y;
+    r->x1 = line.Width;
+    r->baseline_y_delta = g.FontSize;
     r->ymin = 0.0f;
-    r->ymax = size.y;
-    r->num_chars = (int)(text_remaining - (text + line_start_idx));
+    r->ymax = g.FontSize;
+    r->num_chars = line_end_idx - line_start_idx;
 }
 
 static bool is_separator(unsigned int c)                                        { return ImCharIsBlankW(c) || c==',' || c==';' || c=='(' || c==')' || c=='{' || c=='}' || c=='[' || c==']' || c=='|'; }
@@ -2938,14 +2961,28 @@ static void STB_TEXTEDIT_DELETECHARS(STB_TEXTEDIT_STRING* obj, int pos, int n)
     ImWchar* dst = obj->TextW.Data + pos;
 
     // We maintain our buffer length in both UTF-8 and wchar formats
-    obj->CurLenA -= ImTextCountUtf8BytesFromStr(dst, dst + n);
+    const int n_utf8 = ImTextCountUtf8BytesFromStr(dst, dst + n);
+    obj->CurLenA -= n_utf8;
     obj->CurLenW -= n;
 
-    // Offset remaining text (FIXME-OPT: Use memmove)
-    const ImWchar* src = obj->TextW.Data + pos + n;
-    while (ImWchar c = *src++)
-        *dst++ = c;
-    *dst = '\0';
+    // Offset remaining text
+    memmove(dst, dst + n, (size_t)(obj->CurLenW - pos) * sizeof(ImWchar));
+    obj->TextW[obj->CurLenW] = '\0';
+
+    // Update line index: remove lines starting within the deleted range, offset the following ones
+    const int line_idx = obj->FindLine(pos);
+    int line_remove_end = line_idx + 1;
+    while (line_remove_end < obj->Lines.Size && obj->Lines[line_remove_end].StartW <= pos + n)
+        line_remove_end++;
+    if (line_remove_end > line_idx + 1)
+        obj->Lines.erase(obj->Lines.Data + line_idx + 1, obj->Lines.Data + line_remove_end);
+    for (int line_n = line_idx + 1; line_n < obj->Lines.Size; line_n++)
+    {
+        obj->Lines[line_n].StartW -= n;
+        obj->Lines[line_n].StartA -= n_utf8;
+    }
+    obj->Lines[line_idx].Width = -1.0f;
+    obj->TempBufferDirty = true;
 }
 
 static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const ImWchar* new_text, int new_text_len)
@@ -2976,25 +3013,59 @@ static bool STB_TEXTEDIT_INSERTCHARS(STB_TEXTEDIT_STRING* obj, int pos, const Im
     obj->CurLenA += new_text_len_utf8;
     obj->TextW[obj->CurLenW] = '\0';
 
+    // Update line index: offset the following lines, then insert one line per \n in the new text
+    const int line_idx = obj->FindLine(pos);
+    const int lines_count = obj->Lines.Size;
+    for (int line_n = line_idx + 1; line_n < lines_count; line_n++)
+    {
+        obj->Lines[line_n].StartW += new_text_len;
+        obj->Lines[line_n].StartA += new_text_len_utf8;
+    }
+    int new_lines_count = 0;
+    for (int n = 0; n < new_text_len; n++)
+        if (new_text[n] == '\n')
+            new_lines_count++;
+    if (new_lines_count > 0)
+    {
+        obj->Lines.resize(lines_count + new_lines_count);
+        ImGuiInputTextLine* lines = obj->Lines.Data;
+        memmove(lines + line_idx + 1 + new_lines_count, lines + line_idx + 1, (size_t)(lines_count - line_idx - 1) * sizeof(ImGuiInputTextLine));
+        int offset_a = lines[line_idx].StartA + ImTextCountUtf8BytesFromStr(text + lines[line_idx].StartW, text + pos);
+        int segment_start = 0;
+        ImGuiInputTextLine* new_line = lines + line_idx + 1;
+        for (int n = 0; n < new_text_len; n++)
+            if (new_text[n] == '\n')
+            {
+                offset_a += ImTextCountUtf8BytesFromStr(new_text + segment_start, new_text + n + 1);
+                segment_start = n + 1;
+                new_line->StartW = pos + n + 1;
+                new_line->StartA = offset_a;
+                new_line->Width = -1.0f;
+                new_line++;
+            }
+    }
+    obj->Lines[line_idx].Width = -1.0f;
+    obj->TempBufferDirty = true;
+
     return true;
 }
 
 // We don't use an enum so we can build even with conflicting symbols (if another user of stb_textedit.h leak their STB_TEXTEDIT_K_* symbols)
-#define STB_TEXTEDIT_K_LEFT         0x10000 // keyboard input to move cursor left
-#define STB_TEXTEDIT_K_RIGHT        0x10001 // keyboard input to move cursor right
-#define STB_TEXTEDIT_K_UP           0x10002 // keyboard input to move cursor up
-#define STB_TEXTEDIT_K_DOWN         0x10003 // keyboard input to move cursor down
-#define STB_TEXTEDIT_K_LINESTART    0x10004 // keyboard input to move cursor to start of line
-#define STB_TEXTEDIT_K_LINEEND      0x10005 // keyboard input to move cursor to end of line
-#define STB_TEXTEDIT_K_TEXTSTART    0x10006 // keyboard input to move cursor to start of text
-#define STB_TEXTEDIT_K_TEXTEND      0x10007 // keyboard input to move cursor to end of text
-#define STB_TEXTEDIT_K_DELETE       0x10008 // keyboard input to delete selection or character under cursor
-#define STB_TEXTEDIT_K_BACKSPACE    0x10009 // keyboard input to delete selection or character left of cursor
-#define STB_TEXTEDIT_K_UNDO         0x1000A // keyboard input to perform undo
-#define STB_TEXTEDIT_K_REDO         0x1000B // keyboard input to perform redo
-#define STB_TEXTEDIT_K_WORDLEFT     0x1000C // keyboard input to move cursor left one word
-#define STB_TEXTEDIT_K_WORDRIGHT    0x1000D // keyboard input to move cursor right one word
-#define STB_TEXTEDIT_K_SHIFT        0x20000
+#define STB_TEXTEDIT_K_LEFT         0x200000 // keyboard input to move cursor left (keys are above IM_UNICODE_CODEPOINT_MAX, so they don't collide with characters)
+#define STB_TEXTEDIT_K_RIGHT        0x200001 // keyboard input to move cursor right
+#define STB_TEXTEDIT_K_UP           0x200002 // keyboard input to move cursor up
+#define STB_TEXTEDIT_K_DOWN         0x200003 // keyboard input to move cursor down
+#define STB_TEXTEDIT_K_LINESTART    0x200004 // keyboard input to move cursor to start of line
+#define STB_TEXTEDIT_K_LINEEND      0x200005 // keyboard input to move cursor to end of line
+#define STB_TEXTEDIT_K_TEXTSTART    0x200006 // keyboard input to move cursor to start of text
+#define STB_TEXTEDIT_K_TEXTEND      0x200007 // keyboard input to move cursor to end of text
+#define STB_TEXTEDIT_K_DELETE       0x200008 // keyboard input to delete selection or character under cursor
+#define STB_TEXTEDIT_K_BACKSPACE    0x200009 // keyboard input to delete selection or character left of cursor
+#define STB_TEXTEDIT_K_UNDO         0x20000A // keyboard input to perform undo
+#define STB_TEXTEDIT_K_REDO         0x20000B // keyboard input to perform redo
+#define STB_TEXTEDIT_K_WORDLEFT     0x20000C // keyboard input to move cursor left one word
+#define STB_TEXTEDIT_K_WORDRIGHT    0x20000D // keyboard input to move cursor right one word
+#define STB_TEXTEDIT_K_SHIFT        0x400000
 
 #define STB_TEXTEDIT_IMPLEMENTATION
 #include "imstb_textedit.h"
@@ -3008,6 +3079,47 @@ void ImGuiInputTextState::OnKeyPressed(int key)
     CursorAnimReset();
 }
 
+void ImGuiInputTextState::RebuildLines()
+{
+    Lines.resize(0);
+    ImGuiInputTextLine line;
+    line.StartW = line.StartA = 0;
+    line.Width = -1.0f;
+    Lines.push_back(line);
+    const ImWchar* text = TextW.Data;
+    for (int n = 0; n < CurLenW; n++)
+        if (text[n] == '\n')
+        {
+            line.StartA += ImTextCountUtf8BytesFromStr(text + line.StartW, text + n + 1);
+            line.StartW = n + 1;
+            Lines.push_back(line);
+        }
+    LinesLastIdx = 0;
+    TempBufferDirty = true;
+}
+
+int ImGuiInputTextState::FindLine(int pos)
+{
+    IM_ASSERT(Lines.Size > 0);
+    int idx = ImMin(LinesLastIdx, Lines.Size - 1);
+    if (Lines[idx].StartW <= pos && (idx + 1 == Lines.Size || pos < Lines[idx + 1].StartW))
+        return idx;
+    if (idx + 1 < Lines.Size && Lines[idx + 1].StartW <= pos && (idx + 2 == Lines.Size || pos < Lines[idx + 2].StartW))
+        return LinesLastIdx = idx + 1;
+
+    // Binary search for the last line starting at or before 'pos'
+    int lo = 0, hi = Lines.Size - 1;
+    while (lo < hi)
+    {
+        const int mid = (lo + hi + 1) >> 1;
+        if (Lines[mid].StartW <= pos)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return LinesLastIdx = lo;
+}
+
 ImGuiInputTextCallbackData::ImGuiInputTextCallbackData()
 {
     memset(this, 0, sizeof(*this));
@@ -3230,6 +3342,7 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
             const char* buf_end = NULL;
             edit_state.CurLenW = ImTextStrFromUtf8(edit_state.TextW.Data, buf_size, buf, NULL, &buf_end);
             edit_state.CurLenA = (int)(buf_end - buf); // We can't get the result from ImStrncpy() above because it is not UTF-8 aware. Here we'll cut off malformed UTF-8.
+            edit_state.RebuildLines();
             edit_state.CursorAnimReset();
 
             // Preserve cursor position and undo/redo stack if we come back to same widget
@@ -3280,6 +3393,7 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
             const char* buf_end = NULL;
             edit_state.CurLenW = ImTextStrFromUtf8(edit_state.TextW.Data, edit_state.TextW.Size, buf, NULL, &buf_end);
             edit_state.CurLenA = (int)(buf_end - buf);
+            edit_state.RebuildLines();
             edit_state.CursorClamp();
         }
 
@@ -3425,6 +3539,7 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
                 edit_state.TempBuffer.resize((ie-ib) * 4 + 1);
                 ImTextStrToUtf8(edit_state.TempBuffer.Data, edit_state.TempBuffer.Size, edit_state.TextW.Data+ib, edit_state.TextW.Data+ie);
                 SetClipboardText(edit_state.TempBuffer.Data);
+                edit_state.TempBufferDirty = true;
             }
             if (is_cut)
             {
@@ -3438,9 +3553,9 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
         {
             if (const char* clipboard = GetClipboardText())
             {
-                // Filter pasted buffer
+                // Filter pasted buffer (transient memory, released by the next NewFrame())
                 const int clipboard_len = (int)strlen(clipboard);
-                ImWchar* clipboard_filtered = (ImWchar*)MemAlloc((clipboard_len+1) * sizeof(ImWchar));
+                ImWchar* clipboard_filtered = (ImWchar*)MemAllocFrame((clipboard_len+1) * sizeof(ImWchar));
                 int clipboard_filtered_len = 0;
                 for (const char* s = clipboard; *s; )
                 {
@@ -3448,7 +3563,7 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
                     s += ImTextCharFromUtf8(&c, s, NULL);
                     if (c == 0)
                         break;
-                    if (c >= 0x10000 || !InputTextFilterCharacter(&c, flags, callback, callback_user_data))
+                    if (c > IM_UNICODE_CODEPOINT_MAX || !InputTextFilterCharacter(&c, flags, callback, callback_user_data))
                         continue;
                     clipboard_filtered[clipboard_filtered_len++] = (ImWchar)c;
                 }
@@ -3458,7 +3573,6 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
                     stb_textedit_paste(&edit_state, &edit_state.StbState, clipboard_filtered, clipboard_filtered_len);
                     edit_state.CursorFollow = true;
                 }
-                MemFree(clipboard_filtered);
             }
         }
     }
@@ -3485,11 +3599,12 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
             // Apply new value immediately - copy modified buffer back
             // Note that as soon as the input box is active, the in-widget value gets priority over any underlying modification of the input buffer
             // FIXME: We actually always render 'buf' when calling DrawList->AddText, making the comment above incorrect.
-            // FIXME-OPT: CPU waste to do this every time the widget is active, should mark dirty state from the stb_textedit callbacks.
-            if (is_editable)
+            // The stb_textedit callbacks mark TempBuffer dirty so we only convert TextW again after it has been modified.
+            if (is_editable && edit_state.TempBufferDirty)
             {
                 edit_state.TempBuffer.resize(edit_state.TextW.Size * 4 + 1);
                 ImTextStrToUtf8(edit_state.TempBuffer.Data, edit_state.TempBuffer.Size, edit_state.TextW.Data, NULL);
+                edit_state.TempBufferDirty = false;
             }
 
             // User callback
@@ -3555,6 +3670,8 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
                             edit_state.TextW.resize(edit_state.TextW.Size + (callback_data.BufTextLen - backup_current_text_length));
                         edit_state.CurLenW = ImTextStrFromUtf8(edit_state.TextW.Data, edit_state.TextW.Size, callback_data.Buf, NULL);
                         edit_state.CurLenA = callback_data.BufTextLen;  // Assume correct length and valid UTF-8 from user, saves us an extra strlen()
+                        edit_state.RebuildLines();
+                        edit_state.TempBufferDirty = false;             // TempBuffer is the source of the new text
                         edit_state.CursorAnimReset();
                     }
                 }
@@ -3636,47 +3753,22 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
         ImVec2 cursor_offset, select_start_offset;
 
         {
-            // Count lines + find lines numbers straddling 'cursor' and 'select_start' position.
-            const ImWchar* searches_input_ptr[2];
-            searches_input_ptr[0] = text_begin + edit_state.StbState.cursor;
-            searches_input_ptr[1] = NULL;
-            int searches_remaining = 1;
-            int searches_result_line_number[2] = { -1, -999 };
-            if (edit_state.StbState.select_start != edit_state.StbState.select_end)
-            {
-                searches_input_ptr[1] = text_begin + ImMin(edit_state.StbState.select_start, edit_state.StbState.select_end);
-                searches_result_line_number[1] = -1;
-                searches_remaining++;
-            }
-
-            // Iterate all lines to find our line numbers
-            // In multi-line mode, we never exit the loop until all lines are counted, so add one extra to the searches_remaining counter.
-            searches_remaining += is_multiline ? 1 : 0;
-            int line_count = 0;
-            //for (const ImWchar* s = text_begin; (s = (const ImWchar*)wcschr((const wchar_t*)s, (wchar_t)'\n')) != NULL; s++)  // FIXME-OPT: Could use this when wchar_t are 16-bits
-            for (const ImWchar* s = text_begin; *s != 0; s++)
-                if (*s == '\n')
-                {
-                    line_count++;
-                    if (searches_result_line_number[0] == -1 && s >= searches_input_ptr[0]) { searches_result_line_number[0] = line_count; if (--searches_remaining <= 0) break; }
-                    if (searches_result_line_number[1] == -1 && s >= searches_input_ptr[1]) { searches_result_line_number[1] = line_count; if (--searches_remaining <= 0) break; }
-                }
-            line_count++;
-            if (searches_result_line_number[0] == -1) searches_result_line_number[0] = line_count;
-            if (searches_result_line_number[1] == -1) searches_result_line_number[1] = line_count;
-
+            // Find lines numbers straddling 'cursor' and 'select_start' position, using the line index maintained by the stb_textedit callbacks.
             // Calculate 2d position by finding the beginning of the line and measuring distance
-            cursor_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[0], text_begin), searches_input_ptr[0]).x;
-            cursor_offset.y = searches_result_line_number[0] * g.FontSize;
-            if (searches_result_line_number[1] >= 0)
+            const int cursor_line = edit_state.FindLine(edit_state.StbState.cursor);
+            cursor_offset.x = InputTextCalcTextSizeW(text_begin + edit_state.Lines[cursor_line].StartW, text_begin + edit_state.StbState.cursor).x;
+            cursor_offset.y = (cursor_line + 1) * g.FontSize;
+            if (edit_state.StbState.select_start != edit_state.StbState.select_end)
             {
-                select_start_offset.x = InputTextCalcTextSizeW(ImStrbolW(searches_input_ptr[1], text_begin), searches_input_ptr[1]).x;
-                select_start_offset.y = searches_result_line_number[1] * g.FontSize;
+                const int select_start = ImMin(edit_state.StbState.select_start, edit_state.StbState.select_end);
+                const int select_start_line = edit_state.FindLine(select_start);
+                select_start_offset.x = InputTextCalcTextSizeW(text_begin + edit_state.Lines[select_start_line].StartW, text_begin + select_start).x;
+                select_start_offset.y = (select_start_line + 1) * g.FontSize;
             }
 
             // Store text height (note that we haven't calculated text width at all, see GitHub issues #383, #1224)
             if (is_multiline)
-                text_size = ImVec2(size.x, line_count * g.FontSize);
+                text_size = ImVec2(size.x, edit_state.Lines.Size * g.FontSize);
         }
 
         // Scroll
@@ -3722,7 +3814,20 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
             float bg_offy_dn = is_multiline ? 0.0f : 2.0f;
             ImU32 bg_color = GetColorU32(ImGuiCol_TextSelectedBg);
             ImVec2 rect_pos = render_pos + select_start_offset - render_scroll;
-            for (const ImWchar* p = text_selected_begin; p < text_selected_end; )
+            const ImWchar* p = text_selected_begin;
+            if (rect_pos.y < clip_rect.y)
+            {
+                // Jump over most lines above the visible area with the line index, the loop below handles the remaining ones
+                const int select_start_line = edit_state.FindLine((int)(text_selected_begin - text_begin));
+                const int lines_to_skip = ImMin((int)((clip_rect.y - rect_pos.y) / g.FontSize) - 1, edit_state.Lines.Size - 1 - select_start_line);
+                if (lines_to_skip > 0)
+                {
+                    p = text_begin + edit_state.Lines[select_start_line + lines_to_skip].StartW;
+                    rect_pos.x = render_pos.x - render_scroll.x;
+                    rect_pos.y += lines_to_skip * g.FontSize;
+                }
+            }
+            while (p < text_selected_end)
             {
                 if (rect_pos.y > clip_rect.w + g.FontSize)
                     break;
@@ -3749,7 +3854,17 @@ bool ImGui::InputTextEx(const char* label, char* buf, int buf_size, const ImVec2
         }
 
         const int buf_display_len = edit_state.CurLenA;
-        if (is_multiline || buf_display_len < buf_display_max_length)
+        if (is_multiline && buf_display == edit_state.TempBuffer.Data && !edit_state.TempBufferDirty)
+        {
+            // Only submit the visible lines, located with the line index (the range is padded by one line for rounding)
+            const int lines_count = edit_state.Lines.Size;
+            const int line_min = ImClamp((int)((clip_rect.y - render_pos.y) / g.FontSize) - 1, 0, lines_count - 1);
+            const int line_max = ImClamp((int)((clip_rect.w - render_pos.y) / g.FontSize) + 1, line_min, lines_count - 1);
+            const char* text_display_begin = buf_display + edit_state.Lines[line_min].StartA;
+            const char* text_display_end = (line_max + 1 < lines_count) ? buf_display + edit_state.Lines[line_max + 1].StartA : buf_display + buf_display_len;
+            draw_window->DrawList->AddText(g.Font, g.FontSize, render_pos - render_scroll + ImVec2(0.0f, line_min * g.FontSize), GetColorU32(ImGuiCol_Text), text_display_begin, text_display_end);
+        }
+        else if (is_multiline || buf_display_len < buf_display_max_length)
             draw_window->DrawList->AddText(g.Font, g.FontSize, render_pos - render_scroll, GetColorU32(ImGuiCol_Text), buf_display, buf_display + buf_display_len, 0.0f, is_multiline ? NULL : &clip_rect);
 
         // Draw blinking cursor
@@ -5237,6 +5352,8 @@ bool ImGui::ListBox(const char* label, int* current_item, bool (*items_getter)(v
 // - PlotEx() [Internal]
 // - PlotLines()
 // - PlotHistogram()
+// - ImGuiPlotPyramid
+// - PlotPyramidEx() [Internal]
 //-------------------------------------------------------------------------
 
 void ImGui::PlotEx(ImGuiPlotType plot_type, const char* label, float (*values_getter)(void* data, int idx), void* data, int values_count, int values_offset, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
@@ -5386,6 +5503,190 @@ void ImGui::PlotHistogram(const char* label, float (*values_getter)(void* data,
     PlotEx(ImGuiPlotType_Histogram, label, values_getter, data, values_count, values_offset, overlay_text, scale_min, scale_max, graph_size);
 }
 
+void ImGuiPlotPyramid::AddSamples(const float* values, int values_count)
+{
+    if (values_count <= 0)
+        return;
+    const int idx_begin = Samples.Size;
+    Samples.resize(Samples.Size + values_count);
+    memcpy(Samples.Data + idx_begin, values, (size_t)values_count * sizeof(float));
+
+    // Update each level from the level below, starting from the first entry covering new samples.
+    // A level is only needed when the level below has more than one entry.
+    int below_dirty_begin = idx_begin;
+    for (int level_n = 0; level_n < IM_ARRAYSIZE(Levels); level_n++)
+    {
+        const int below_size = (level_n == 0) ? Samples.Size : Levels[level_n - 1].Size;
+        if (below_size <= 1)
+            break;
+        ImVector<ImVec2>& level = Levels[level_n];
+        const int dirty_begin = below_dirty_begin >> 2;
+        level.resize((below_size + 3) >> 2);
+        for (int n = dirty_begin; n < level.Size; n++)
+        {
+            const int below_n_end = ImMin(n * 4 + 4, below_size);
+            ImVec2 min_max(FLT_MAX, -FLT_MAX);
+            if (level_n == 0)
+            {
+                for (const float* v = Samples.Data + n * 4; v < Samples.Data + below_n_end; v++)
+                {
+                    min_max.x = ImMin(min_max.x, *v);
+                    min_max.y = ImMax(min_max.y, *v);
+                }
+            }
+            else
+            {
+                for (const ImVec2* v = Levels[level_n - 1].Data + n * 4; v < Levels[level_n - 1].Data + below_n_end; v++)
+                {
+                    min_max.x = ImMin(min_max.x, v->x);
+                    min_max.y = ImMax(min_max.y, v->y);
+                }
+            }
+            level.Data[n] = min_max;
+        }
+        below_dirty_begin = dirty_begin;
+    }
+}
+
+ImVec2 ImGuiPlotPyramid::GetMinMax(int idx_begin, int idx_end) const
+{
+    IM_ASSERT(idx_begin >= 0 && idx_begin <= idx_end && idx_end <= Samples.Size);
+    ImVec2 min_max(FLT_MAX, -FLT_MAX);
+
+    // Consume unaligned entries at both ends of the range, then move to the coarser level where the remaining range is 4 times smaller.
+    int lo = idx_begin, hi = idx_end;
+    for (int level_n = -1; lo < hi; level_n++)
+    {
+        if (level_n == -1)
+        {
+            for (; lo < hi && (lo & 3) != 0; lo++)
+                min_max = ImVec2(ImMin(min_max.x, Samples.Data[lo]), ImMax(min_max.y, Samples.Data[lo]));
+            for (; lo < hi && (hi & 3) != 0; hi--)
+                min_max = ImVec2(ImMin(min_max.x, Samples.Data[hi - 1]), ImMax(min_max.y, Samples.Data[hi - 1]));
+        }
+        else
+        {
+            const ImVec2* level = Levels[level_n].Data;
+            for (; lo < hi && (lo & 3) != 0; lo++)
+                min_max = ImVec2(ImMin(min_max.x, level[lo].x), ImMax(min_max.y, level[lo].y));
+            for (; lo < hi && (hi & 3) != 0; hi--)
+                min_max = ImVec2(ImMin(min_max.x, level[hi - 1].x), ImMax(min_max.y, level[hi - 1].y));
+        }
+        lo >>= 2;
+        hi >>= 2;
+    }
+    return min_max;
+}
+
+// Display one column per pixel with the min/max envelope of the samples it covers, so every peak is visible.
+// When there are fewer samples than pixels, we use PlotEx() which displays every sample.
+void ImGui::PlotPyramidEx(ImGuiPlotType plot_type, const char* label, const ImGuiPlotPyramid* values, int values_offset, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    if (values_count < 0)
+        values_count = values->Samples.Size - values_offset;
+    IM_ASSERT(values_offset >= 0 && values_count >= 0 && values_offset + values_count <= values->Samples.Size);
+    if (values_count <= (int)(graph_size.x == 0.0f ? CalcItemWidth() : graph_size.x))
+    {
+        ImGuiPlotArrayGetterData data(values->Samples.Data + values_offset, sizeof(float));
+        PlotEx(plot_type, label, &Plot_ArrayGetter, (void*)&data, values_count, 0, overlay_text, scale_min, scale_max, graph_size);
+        return;
+    }
+
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return;
+
+    ImGuiContext& g = *GImGui;
+    const ImGuiStyle& style = g.Style;
+
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    if (graph_size.x == 0.0f)
+        graph_size.x = CalcItemWidth();
+    if (graph_size.y == 0.0f)
+        graph_size.y = label_size.y + (style.FramePadding.y * 2);
+
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + ImVec2(graph_size.x, graph_size.y));
+    const ImRect inner_bb(frame_bb.Min + style.FramePadding, frame_bb.Max - style.FramePadding);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Max + ImVec2(label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f, 0));
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, 0, &frame_bb))
+        return;
+    const bool hovered = ItemHoverable(inner_bb, 0);
+
+    // Determine scale from values if not specified
+    if (scale_min == FLT_MAX || scale_max == FLT_MAX)
+    {
+        const ImVec2 min_max = values->GetMinMax(values_offset, values_offset + values_count);
+        if (scale_min == FLT_MAX)
+            scale_min = min_max.x;
+        if (scale_max == FLT_MAX)
+            scale_max = min_max.y;
+    }
+
+    RenderFrame(frame_bb.Min, frame_bb.Max, GetColorU32(ImGuiCol_FrameBg), true, style.FrameRounding);
+
+    const int res_w = ImMax((int)inner_bb.GetWidth(), 1);
+    const float inv_scale = (scale_min == scale_max) ? 0.0f : (1.0f / (scale_max - scale_min));
+    const float histogram_zero_line_t = (scale_min * scale_max < 0.0f) ? (-scale_min * inv_scale) : (scale_min < 0.0f ? 0.0f : 1.0f);   // Where does the zero line stands
+    const int idx_end = values_offset + values_count;
+
+    // Tooltip on hover
+    int column_hovered = -1;
+    if (hovered)
+    {
+        const float t = ImClamp((g.IO.MousePos.x - inner_bb.Min.x) / (inner_bb.Max.x - inner_bb.Min.x), 0.0f, 0.9999f);
+        column_hovered = (int)(t * res_w);
+        const int idx0 = (int)((ImS64)values_count * column_hovered / res_w);
+        const int idx1 = (int)((ImS64)values_count * (column_hovered + 1) / res_w);
+        const ImVec2 min_max = values->GetMinMax(values_offset + idx0, values_offset + idx1);
+        SetTooltip("%d..%d\nmin: %8.4g\nmax: %8.4g", idx0, idx1 - 1, min_max.x, min_max.y);
+    }
+
+    const ImU32 col_base = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLines : ImGuiCol_PlotHistogram);
+    const ImU32 col_hovered = GetColorU32((plot_type == ImGuiPlotType_Lines) ? ImGuiCol_PlotLinesHovered : ImGuiCol_PlotHistogramHovered);
+
+    for (int n = 0; n < res_w; n++)
+    {
+        // Lines also cover the first sample of the next column, so consecutive columns connect like the segments of a polyline.
+        const int idx0 = values_offset + (int)((ImS64)values_count * n / res_w);
+        int idx1 = values_offset + (int)((ImS64)values_count * (n + 1) / res_w);
+        if (plot_type == ImGuiPlotType_Lines && idx1 < idx_end)
+            idx1++;
+        const ImVec2 min_max = values->GetMinMax(idx0, idx1);
+        float t_top = 1.0f - ImSaturate((min_max.y - scale_min) * inv_scale);
+        float t_bottom = 1.0f - ImSaturate((min_max.x - scale_min) * inv_scale);
+        if (plot_type == ImGuiPlotType_Histogram)
+        {
+            t_top = ImMin(t_top, histogram_zero_line_t);
+            t_bottom = ImMax(t_bottom, histogram_zero_line_t);
+        }
+
+        // NB: Columns are at least 1 pixel wide and tall
+        ImVec2 pos0 = ImLerp(inner_bb.Min, inner_bb.Max, ImVec2((float)n / res_w, t_top));
+        ImVec2 pos1 = ImLerp(inner_bb.Min, inner_bb.Max, ImVec2((float)(n + 1) / res_w, t_bottom));
+        pos1.x = ImMax(pos1.x, pos0.x + 1.0f);
+        pos1.y = ImMax(pos1.y, pos0.y + 1.0f);
+        window->DrawList->AddRectFilled(pos0, pos1, (n == column_hovered) ? col_hovered : col_base);
+    }
+
+    // Text overlay
+    if (overlay_text)
+        RenderTextClipped(ImVec2(frame_bb.Min.x, frame_bb.Min.y + style.FramePadding.y), frame_bb.Max, overlay_text, NULL, NULL, ImVec2(0.5f,0.0f));
+
+    if (label_size.x > 0.0f)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, inner_bb.Min.y), label);
+}
+
+void ImGui::PlotLines(const char* label, const ImGuiPlotPyramid* values, int values_offset, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotPyramidEx(ImGuiPlotType_Lines, label, values, values_offset, values_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
+void ImGui::PlotHistogram(const char* label, const ImGuiPlotPyramid* values, int values_offset, int values_count, const char* overlay_text, float scale_min, float scale_max, ImVec2 graph_size)
+{
+    PlotPyramidEx(ImGuiPlotType_Histogram, label, values, values_offset, values_count, overlay_text, scale_min, scale_max, graph_size);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Value helpers
 // Those is not very useful, legacy API.
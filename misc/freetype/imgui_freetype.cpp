@@ -12,6 +12,7 @@
 // - v0.56: (2018/06/08) added support for ImFontConfig::GlyphMinAdvanceX, GlyphMaxAdvanceX.
 // - v0.60: (2019/01/10) re-factored to match big update in STB builder. fixed texture height waste. fixed redundant glyphs when merging. support for glyph padding.
 // - v0.61: (2019/01/15) added support for imgui allocators + added FreeType only override function SetAllocatorFunctions().
+// - v0.62: (2019/02/22) rasterize glyphs in parallel when ImFontAtlas::BuildParallelForFunc is set. added BuildFontAtlasWithCacheFile().
 
 // Gamma Correct Blending:
 //  FreeType assumes blending in linear space rather than gamma space.
@@ -93,9 +94,10 @@ namespace
     };
 
     // FreeType glyph rasterizer.
-    // NB: No ctor/dtor, explicitly call Init()/Shutdown()
+    // NB: Call InitFont()/CloseFont() explicitly. The destructor closes the face if it is still open.
     struct FreeTypeFont
     {
+        FreeTypeFont()          { memset(&Info, 0, sizeof(Info)); Face = NULL; UserFlags = 0; LoadFlags = 0; }
         bool                    InitFont(FT_Library ft_library, const ImFontConfig& cfg, unsigned int extra_user_flags); // Initialize from an external data buffer. Doesn't copy data, and you must ensure it stays valid up to this object lifetime.
         void                    CloseFont();
         void                    SetPixelHeight(int pixel_height); // Change font pixel size. All following calls to RasterizeGlyph() will use this size
@@ -251,11 +253,97 @@ namespace
 #include "imstb_rectpack.h"
 #endif
 
+// Default memory allocators
+static void* ImFreeTypeDefaultAllocFunc(size_t size, void* user_data)	{ IM_UNUSED(user_data); return ImGui::MemAlloc(size); }
+static void  ImFreeTypeDefaultFreeFunc(void* ptr, void* user_data)	    { IM_UNUSED(user_data); ImGui::MemFree(ptr); }
+
+// Current memory allocators
+static void* (*GImFreeTypeAllocFunc)(size_t size, void* user_data) = ImFreeTypeDefaultAllocFunc;
+static void  (*GImFreeTypeFreeFunc)(void* ptr, void* user_data) = ImFreeTypeDefaultFreeFunc;
+static void* GImFreeTypeAllocatorUserData = NULL;
+
+// Allocations made from parallel build jobs (see ImFontAtlas::BuildParallelForFunc) bypass ImGui::MemAlloc()/MemFree(), which update non-atomic metrics.
+// They call the imgui allocator functions directly, or the allocators set with ImGuiFreeType::SetAllocatorFunctions() which then need to be thread-safe.
+static void* ImFreeTypeMemAlloc(size_t size, bool from_job)
+{
+    if (!from_job || GImFreeTypeAllocFunc != ImFreeTypeDefaultAllocFunc)
+        return GImFreeTypeAllocFunc(size, GImFreeTypeAllocatorUserData);
+    void* (*alloc_func)(size_t, void*); void (*free_func)(void*, void*); void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    return alloc_func(size, user_data);
+}
+
+static void ImFreeTypeMemFree(void* ptr, bool from_job)
+{
+    if (!from_job || GImFreeTypeFreeFunc != ImFreeTypeDefaultFreeFunc)
+    {
+        GImFreeTypeFreeFunc(ptr, GImFreeTypeAllocatorUserData);
+        return;
+    }
+    void* (*alloc_func)(size_t, void*); void (*free_func)(void*, void*); void* user_data;
+    ImGui::GetAllocatorFunctions(&alloc_func, &free_func, &user_data);
+    free_func(ptr, user_data);
+}
+
+// FreeType memory allocation callbacks (FT_MemoryRec_::user is non-NULL for the libraries created by parallel build jobs)
+static void* FreeType_Alloc(FT_Memory memory, long size)
+{
+    return ImFreeTypeMemAlloc((size_t)size, memory->user != NULL);
+}
+
+static void FreeType_Free(FT_Memory memory, void* block)
+{
+    ImFreeTypeMemFree(block, memory->user != NULL);
+}
+
+static void* FreeType_Realloc(FT_Memory memory, long cur_size, long new_size, void* block)
+{
+    // Implement realloc() as we don't ask user to provide it.
+    if (block == NULL)
+        return ImFreeTypeMemAlloc((size_t)new_size, memory->user != NULL);
+
+    if (new_size == 0)
+    {
+        ImFreeTypeMemFree(block, memory->user != NULL);
+        return NULL;
+    }
+
+    if (new_size > cur_size)
+    {
+        void* new_block = ImFreeTypeMemAlloc((size_t)new_size, memory->user != NULL);
+        memcpy(new_block, block, (size_t)cur_size);
+        ImFreeTypeMemFree(block, memory->user != NULL);
+        return new_block;
+    }
+
+    return block;
+}
+
+static FT_Library ImFreeTypeNewLibrary(FT_MemoryRec_* memory_rec, bool from_job)
+{
+    // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
+    memset(memory_rec, 0, sizeof(*memory_rec));
+    memory_rec->user = from_job ? memory_rec : NULL;
+    memory_rec->alloc = &FreeType_Alloc;
+    memory_rec->free = &FreeType_Free;
+    memory_rec->realloc = &FreeType_Realloc;
+
+    // https://www.freetype.org/freetype2/docs/reference/ft2-module_management.html#FT_New_Library
+    FT_Library ft_library;
+    FT_Error error = FT_New_Library(memory_rec, &ft_library);
+    if (error != 0)
+        return NULL;
+
+    // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
+    FT_Add_Default_Modules(ft_library);
+    return ft_library;
+}
+
 struct ImFontBuildSrcGlyphFT
 {
     GlyphInfo           Info;
     uint32_t            Codepoint;
-    unsigned char*      BitmapData;         // Point within one of the dst_tmp_bitmap_buffers[] array
+    unsigned char*      BitmapData;         // Point within the bitmap buffers of the job which rasterized the glyph
 };
 
 struct ImFontBuildSrcDataFT
@@ -279,6 +367,120 @@ struct ImFontBuildDstDataFT
     ImBoolVector        GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+struct ImFontBuildRenderJobFT
+{
+    int                 SrcIndex;           // Index into atlas->ConfigData[] and src_tmp_array[]
+    int                 GlyphStart;         // Range of glyphs in src_tmp.GlyphsList[]
+    int                 GlyphCount;
+    unsigned char*      BitmapBuffer;       // Last allocated temporary buffer holding rasterized glyphs. Each buffer starts with a pointer to the previous one.
+    int                 BitmapBufferUsed;
+    int                 BitmapBufferSize;
+    bool                Failed;             // Font face couldn't be loaded by the job (glyphs are left unrendered)
+};
+
+struct ImFontBuildRenderJobsFT
+{
+    ImFontAtlas*                        Atlas;
+    ImFontBuildSrcDataFT*               SrcTmpArray;
+    unsigned int                        ExtraFlags;
+    bool                                Parallel;   // Jobs may run on other threads
+    ImVector<ImFontBuildRenderJobFT>    Jobs;
+};
+
+static unsigned char* ImFontAtlasBuildRenderJobAllocBitmapFT(ImFontBuildRenderJobFT* job, int size, bool from_job)
+{
+    // We allocate in chunks of 64 KB to not waste too much extra memory ahead. Hopefully users of FreeType won't find the temporary allocations.
+    const int BITMAP_BUFFERS_CHUNK_SIZE = 64 * 1024;
+    if (job->BitmapBuffer == NULL || job->BitmapBufferUsed + size > job->BitmapBufferSize)
+    {
+        const int buffer_size = ImMax(size, BITMAP_BUFFERS_CHUNK_SIZE);
+        unsigned char* buffer = (unsigned char*)ImFreeTypeMemAlloc(sizeof(unsigned char*) + (size_t)buffer_size, from_job);
+        memcpy(buffer, &job->BitmapBuffer, sizeof(unsigned char*));
+        job->BitmapBuffer = buffer;
+        job->BitmapBufferUsed = 0;
+        job->BitmapBufferSize = buffer_size;
+    }
+    unsigned char* bitmap = job->BitmapBuffer + sizeof(unsigned char*) + job->BitmapBufferUsed;
+    job->BitmapBufferUsed += size;
+    return bitmap;
+}
+
+static void ImFontAtlasBuildRenderJobsFreeBitmapsFT(ImFontBuildRenderJobsFT* jobs)
+{
+    for (int job_i = 0; job_i < jobs->Jobs.Size; job_i++)
+        for (unsigned char* buffer = jobs->Jobs[job_i].BitmapBuffer; buffer != NULL; )
+        {
+            unsigned char* buffer_prev;
+            memcpy(&buffer_prev, buffer, sizeof(unsigned char*));
+            ImFreeTypeMemFree(buffer, jobs->Parallel);
+            buffer = buffer_prev;
+        }
+}
+
+// Rasterize a range of glyphs of one source font into temporary buffers, and set the size of their rectangles.
+// FreeType objects can't be used from multiple threads: parallel jobs load their own copy of the face, in their own FT_Library.
+static void ImFontAtlasBuildRenderJobFT(void* job_data, int job_index)
+{
+    ImFontBuildRenderJobsFT* jobs = (ImFontBuildRenderJobsFT*)job_data;
+    ImFontBuildRenderJobFT& job = jobs->Jobs[job_index];
+    ImFontAtlas* atlas = jobs->Atlas;
+    const ImFontConfig& cfg = atlas->ConfigData[job.SrcIndex];
+    ImFontBuildSrcDataFT& src_tmp = jobs->SrcTmpArray[job.SrcIndex];
+
+    FreeTypeFont* font = &src_tmp.Font;
+    FreeTypeFont job_font;
+    FT_MemoryRec_ job_memory_rec;
+    FT_Library job_ft_library = NULL;
+    if (jobs->Parallel)
+    {
+        job_ft_library = ImFreeTypeNewLibrary(&job_memory_rec, true);
+        if (!job_ft_library || !job_font.InitFont(job_ft_library, cfg, jobs->ExtraFlags))
+        {
+            job.Failed = true;
+            job_font.CloseFont();
+            if (job_ft_library)
+                FT_Done_Library(job_ft_library);
+            return;
+        }
+        font = &job_font;
+    }
+
+    // Compute multiply table if requested
+    const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
+    unsigned char multiply_table[256];
+    if (multiply_enabled)
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
+
+    // Gather the sizes of all rectangles we will need to pack
+    const int padding = atlas->TexGlyphPadding;
+    for (int glyph_i = job.GlyphStart; glyph_i < job.GlyphStart + job.GlyphCount; glyph_i++)
+    {
+        ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
+
+        const FT_Glyph_Metrics* metrics = font->LoadGlyph(src_glyph.Codepoint);
+        IM_ASSERT(metrics != NULL);
+        if (metrics == NULL)
+            continue;
+
+        // Render glyph into a bitmap (currently held by FreeType)
+        const FT_Bitmap* ft_bitmap = font->RenderGlyphAndGetInfo(&src_glyph.Info);
+        IM_ASSERT(ft_bitmap);
+
+        // Blit rasterized pixels to our temporary buffer and keep a pointer to it.
+        src_glyph.BitmapData = ImFontAtlasBuildRenderJobAllocBitmapFT(&job, src_glyph.Info.Width * src_glyph.Info.Height, jobs->Parallel);
+        font->BlitGlyph(ft_bitmap, src_glyph.BitmapData, src_glyph.Info.Width * 1, multiply_enabled ? multiply_table : NULL);
+
+        src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
+        src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
+    }
+
+    if (job_ft_library)
+    {
+        job_font.CloseFont();
+        FT_Done_Library(job_ft_library);
+    }
+}
+
 bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, unsigned int extra_flags)
 {
     IM_ASSERT(atlas->ConfigData.Size > 0);
@@ -286,7 +488,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
     ImFontAtlasBuildRegisterDefaultCustomRects(atlas);
 
     // Clear atlas
-    atlas->TexID = (ImTextureID)NULL;
+    atlas->TexID = atlas->TexIDSDF = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
     atlas->TexUvScale = ImVec2(0.0f, 0.0f);
     atlas->TexUvWhitePixel = ImVec2(0.0f, 0.0f);
@@ -307,6 +509,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
         ImFontConfig& cfg = atlas->ConfigData[src_i];
         FreeTypeFont& font_face = src_tmp.Font;
         IM_ASSERT(cfg.DstFont && (!cfg.DstFont->IsLoaded() || cfg.DstFont->ContainerAtlas == atlas));
+        IM_ASSERT(!cfg.SignedDistanceField && "ImFontConfig::SignedDistanceField is only supported by the stb_truetype builder.");
 
         // Find index from cfg.DstFont (we allow the user to set cfg.DstFont. Also it makes casual debugging nicer than when storing indices)
         src_tmp.DstIndex = -1;
@@ -342,7 +545,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
             dst_tmp.GlyphsSet.Resize(dst_tmp.GlyphsHighest + 1);
 
         for (const ImWchar* src_range = src_tmp.SrcRanges; src_range[0] && src_range[1]; src_range += 2)
-            for (int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
+            for (unsigned int codepoint = src_range[0]; codepoint <= src_range[1]; codepoint++)
             {
                 if (cfg.MergeMode && dst_tmp.GlyphsSet.GetBit(codepoint))               // Don't overwrite existing glyphs. We could make this an option (e.g. MergeOverwrite)
                     continue;
@@ -393,68 +596,56 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
     buf_rects.resize(total_glyphs_count);
     memset(buf_rects.Data, 0, (size_t)buf_rects.size_in_bytes());
 
-    // Allocate temporary rasterization data buffers.
+    // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
+    // 8. Render/rasterize font characters into temporary buffers.
     // We could not find a way to retrieve accurate glyph size without rendering them.
     // (e.g. slot->metrics->width not always matching bitmap->width, especially considering the Oblique transform)
-    // We allocate in chunks of 256 KB to not waste too much extra memory ahead. Hopefully users of FreeType won't find the temporary allocations.
-    const int BITMAP_BUFFERS_CHUNK_SIZE = 256 * 1024;
-    int buf_bitmap_current_used_bytes = 0;
-    ImVector<unsigned char*> buf_bitmap_buffers;
-    buf_bitmap_buffers.push_back((unsigned char*)ImGui::MemAlloc(BITMAP_BUFFERS_CHUNK_SIZE));
-
-    // 4. Gather glyphs sizes so we can pack them in our virtual canvas.
-    // 8. Render/rasterize font characters into the texture
-    int total_surface = 0;
+    // Split into jobs of up to GLYPHS_PER_JOB glyphs, which can run in parallel. Larger than with stb_truetype, as each parallel job needs to load its own FT_Face.
+    const int GLYPHS_PER_JOB = 256;
+    ImFontBuildRenderJobsFT jobs;
+    jobs.Atlas = atlas;
+    jobs.SrcTmpArray = src_tmp_array.Data;
+    jobs.ExtraFlags = extra_flags;
+    jobs.Parallel = (atlas->BuildParallelForFunc != NULL);
     int buf_rects_out_n = 0;
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
     {
         ImFontBuildSrcDataFT& src_tmp = src_tmp_array[src_i];
-        ImFontConfig& cfg = atlas->ConfigData[src_i];
         if (src_tmp.GlyphsCount == 0)
             continue;
 
         src_tmp.Rects = &buf_rects[buf_rects_out_n];
         buf_rects_out_n += src_tmp.GlyphsCount;
-
-        // Compute multiply table if requested
-        const bool multiply_enabled = (cfg.RasterizerMultiply != 1.0f);
-        unsigned char multiply_table[256];
-        if (multiply_enabled)
-            ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, cfg.RasterizerMultiply);
-
-        // Gather the sizes of all rectangles we will need to pack
-        const int padding = atlas->TexGlyphPadding;
-        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsList.Size; glyph_i++)
+        for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i += GLYPHS_PER_JOB)
         {
-            ImFontBuildSrcGlyphFT& src_glyph = src_tmp.GlyphsList[glyph_i];
-
-            const FT_Glyph_Metrics* metrics = src_tmp.Font.LoadGlyph(src_glyph.Codepoint);
-            IM_ASSERT(metrics != NULL);
-            if (metrics == NULL)
-                continue;
-
-            // Render glyph into a bitmap (currently held by FreeType)
-            const FT_Bitmap* ft_bitmap = src_tmp.Font.RenderGlyphAndGetInfo(&src_glyph.Info);
-            IM_ASSERT(ft_bitmap);
-
-            // Allocate new temporary chunk if needed
-            const int bitmap_size_in_bytes = src_glyph.Info.Width * src_glyph.Info.Height;
-            if (buf_bitmap_current_used_bytes + bitmap_size_in_bytes > BITMAP_BUFFERS_CHUNK_SIZE)
-            {
-                buf_bitmap_current_used_bytes = 0;
-                buf_bitmap_buffers.push_back((unsigned char*)ImGui::MemAlloc(BITMAP_BUFFERS_CHUNK_SIZE));
-            }
-
-            // Blit rasterized pixels to our temporary buffer and keep a pointer to it.
-            src_glyph.BitmapData = buf_bitmap_buffers.back() + buf_bitmap_current_used_bytes;
-            buf_bitmap_current_used_bytes += bitmap_size_in_bytes;
-            src_tmp.Font.BlitGlyph(ft_bitmap, src_glyph.BitmapData, src_glyph.Info.Width * 1, multiply_enabled ? multiply_table : NULL);
-
-            src_tmp.Rects[glyph_i].w = (stbrp_coord)(src_glyph.Info.Width + padding);
-            src_tmp.Rects[glyph_i].h = (stbrp_coord)(src_glyph.Info.Height + padding);
-            total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+            ImFontBuildRenderJobFT job;
+            memset(&job, 0, sizeof(job));
+            job.SrcIndex = src_i;
+            job.GlyphStart = glyph_i;
+            job.GlyphCount = ImMin(GLYPHS_PER_JOB, src_tmp.GlyphsCount - glyph_i);
+            jobs.Jobs.push_back(job);
         }
     }
+    jobs.Parallel &= (jobs.Jobs.Size > 1);
+    if (jobs.Parallel)
+        atlas->BuildParallelForFunc(ImFontAtlasBuildRenderJobFT, &jobs, jobs.Jobs.Size, atlas->BuildParallelForUserData);
+    else
+        for (int job_i = 0; job_i < jobs.Jobs.Size; job_i++)
+            ImFontAtlasBuildRenderJobFT(&jobs, job_i);
+
+    // A parallel job failing to load its copy of a face leaves its glyphs unrendered: fail the build
+    for (int job_i = 0; job_i < jobs.Jobs.Size; job_i++)
+        if (jobs.Jobs[job_i].Failed)
+        {
+            ImFontAtlasBuildRenderJobsFreeBitmapsFT(&jobs);
+            for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+                src_tmp_array[src_i].~ImFontBuildSrcDataFT();
+            return false;
+        }
+
+    int total_surface = 0;
+    for (int rect_i = 0; rect_i < buf_rects.Size; rect_i++)
+        total_surface += buf_rects[rect_i].w * buf_rects[rect_i].h;
 
     // We need a width for the skyline algorithm, any width!
     // The exact width doesn't really matter much, but some API/GPU have texture size limitations and increasing width can decrease height.
@@ -558,8 +749,7 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
     }
 
     // Cleanup
-    for (int buf_i = 0; buf_i < buf_bitmap_buffers.Size; buf_i++)
-        ImGui::MemFree(buf_bitmap_buffers[buf_i]);
+    ImFontAtlasBuildRenderJobsFreeBitmapsFT(&jobs);
     for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
         src_tmp_array[src_i].~ImFontBuildSrcDataFT();
 
@@ -568,69 +758,55 @@ bool ImFontAtlasBuildWithFreeType(FT_Library ft_library, ImFontAtlas* atlas, uns
     return true;
 }
 
-// Default memory allocators
-static void* ImFreeTypeDefaultAllocFunc(size_t size, void* user_data)	{ IM_UNUSED(user_data); return ImGui::MemAlloc(size); }
-static void  ImFreeTypeDefaultFreeFunc(void* ptr, void* user_data)	    { IM_UNUSED(user_data); ImGui::MemFree(ptr); }
-
-// Current memory allocators
-static void* (*GImFreeTypeAllocFunc)(size_t size, void* user_data) = ImFreeTypeDefaultAllocFunc;
-static void  (*GImFreeTypeFreeFunc)(void* ptr, void* user_data) = ImFreeTypeDefaultFreeFunc;
-static void* GImFreeTypeAllocatorUserData = NULL;
-
-// FreeType memory allocation callbacks
-static void* FreeType_Alloc(FT_Memory /*memory*/, long size)
+bool ImGuiFreeType::BuildFontAtlas(ImFontAtlas* atlas, unsigned int extra_flags)
 {
-    return GImFreeTypeAllocFunc((size_t)size, GImFreeTypeAllocatorUserData);
-}
+    FT_MemoryRec_ memory_rec;
+    FT_Library ft_library = ImFreeTypeNewLibrary(&memory_rec, false);
+    if (ft_library == NULL)
+        return false;
 
-static void FreeType_Free(FT_Memory /*memory*/, void* block)
-{
-    GImFreeTypeFreeFunc(block, GImFreeTypeAllocatorUserData);
+    bool ret = ImFontAtlasBuildWithFreeType(ft_library, atlas, extra_flags);
+    FT_Done_Library(ft_library);
+
+    return ret;
 }
 
-static void* FreeType_Realloc(FT_Memory /*memory*/, long cur_size, long new_size, void* block)
+static bool ImFontAtlasBuildWithCacheFileFT(ImFontAtlas* atlas, const char* filename, unsigned int extra_flags)
 {
-    // Implement realloc() as we don't ask user to provide it.
-    if (block == NULL)
-        return GImFreeTypeAllocFunc((size_t)new_size, GImFreeTypeAllocatorUserData);
-
-    if (new_size == 0)
+    size_t data_size = 0;
+    if (void* data = ImFileLoadToMemory(filename, "rb", &data_size))
     {
-        GImFreeTypeFreeFunc(block, GImFreeTypeAllocatorUserData);
-        return NULL;
-    }
-
-    if (new_size > cur_size)
-    {
-        void* new_block = GImFreeTypeAllocFunc((size_t)new_size, GImFreeTypeAllocatorUserData);
-        memcpy(new_block, block, (size_t)cur_size);
-        GImFreeTypeFreeFunc(block, GImFreeTypeAllocatorUserData);
-        return new_block;
+        const bool loaded = atlas->LoadCacheFromMemory(data, data_size);
+        ImGui::MemFree(data);
+        if (loaded)
+            return true;
     }
+    if (!ImGuiFreeType::BuildFontAtlas(atlas, extra_flags))
+        return false;
 
-    return block;
+    ImVector<unsigned char> cache_data;
+    if (atlas->SaveCacheToMemory(&cache_data))
+        if (FILE* f = ImFileOpen(filename, "wb"))
+        {
+            fwrite(cache_data.Data, 1, (size_t)cache_data.Size, f);
+            fclose(f);
+        }
+    return true;
 }
 
-bool ImGuiFreeType::BuildFontAtlas(ImFontAtlas* atlas, unsigned int extra_flags)
+bool ImGuiFreeType::BuildFontAtlasWithCacheFile(ImFontAtlas* atlas, const char* filename, unsigned int extra_flags)
 {
-    // FreeType memory management: https://www.freetype.org/freetype2/docs/design/design-4.html
-    FT_MemoryRec_ memory_rec = { 0 };
-    memory_rec.alloc = &FreeType_Alloc;
-    memory_rec.free = &FreeType_Free;
-    memory_rec.realloc = &FreeType_Realloc;
-
-    // https://www.freetype.org/freetype2/docs/reference/ft2-module_management.html#FT_New_Library
-    FT_Library ft_library;
-    FT_Error error = FT_New_Library(&memory_rec, &ft_library);
-    if (error != 0)
-        return false;
-
-    // If you don't call FT_Add_Default_Modules() the rest of code may work, but FreeType won't use our custom allocator.
-    FT_Add_Default_Modules(ft_library);
-
-    bool ret = ImFontAtlasBuildWithFreeType(ft_library, atlas, extra_flags);
-    FT_Done_Library(ft_library);
-
+    // Temporarily apply extra flags to the font sources so they are part of the hash identifying the cache. Restored before returning.
+    ImVector<unsigned int> backup_rasterizer_flags;
+    backup_rasterizer_flags.resize(atlas->ConfigData.Size);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+    {
+        backup_rasterizer_flags[src_i] = atlas->ConfigData[src_i].RasterizerFlags;
+        atlas->ConfigData[src_i].RasterizerFlags |= extra_flags;
+    }
+    const bool ret = ImFontAtlasBuildWithCacheFileFT(atlas, filename, extra_flags);
+    for (int src_i = 0; src_i < atlas->ConfigData.Size; src_i++)
+        atlas->ConfigData[src_i].RasterizerFlags = backup_rasterizer_flags[src_i];
     return ret;
 }
 
@@ -27,8 +27,13 @@ namespace ImGuiFreeType
         Oblique         = 1 << 6    // Styling: Should we slant the font, emulating italic style?
     };
 
+    // If atlas->BuildParallelForFunc is set, glyphs are rasterized in parallel. Each job loads its own FT_Library and FT_Face, and allocators set with SetAllocatorFunctions() need to be thread-safe.
     IMGUI_API bool BuildFontAtlas(ImFontAtlas* atlas, unsigned int extra_flags = 0);
 
+    // Load atlas from the given cache file (see ImFontAtlas::LoadCacheFromMemory()), or build it and write the cache file. A valid cache skips FreeType entirely.
+    // The cache is identified by the fonts data and settings (including size and RasterizerFlags, to which 'extra_flags' are added). Use a different file than for ImFontAtlas::BuildWithCacheFile().
+    IMGUI_API bool BuildFontAtlasWithCacheFile(ImFontAtlas* atlas, const char* filename, unsigned int extra_flags = 0);
+
     // By default ImGuiFreeType will use ImGui::MemAlloc()/MemFree().
     // However, as FreeType does lots of allocations we provide a way for the user to redirect it to a separate memory heap if desired:
     IMGUI_API void SetAllocatorFunctions(void* (*alloc_func)(size_t sz, void* user_data), void (*free_func)(void* ptr, void* user_data), void* user_data = NULL);